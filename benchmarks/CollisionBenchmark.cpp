@@ -0,0 +1,209 @@
+// Bullet-vs-enemy broadphase benchmark: the old all-pairs loop against
+// SpatialGrid, on the same random scenes, for both end-position and swept
+// (whole-move) tests. Both sides resolve hits the same way
+// Game::checkCollisions does (first living enemy in store order takes the
+// bullet), and the results are compared so a speedup never hides a behavior change.
+//
+//     cmake -DBROTATO_BUILD_BENCHMARKS=ON ..
+//     ./CollisionBenchmark [iterations]
+#include "Collision.h"
+#include "SpatialGrid.h"
+#include "Vector2.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+namespace {
+
+const float ARENA_WIDTH = 1920.0f;
+const float ARENA_HEIGHT = 1080.0f;
+const float CELL_SIZE = 64.0f;
+const float BULLET_RADIUS = 4.0f;
+const float BULLET_SPEED = 400.0f;
+
+struct Scene {
+    std::vector<Vector2> enemyPositions;
+    std::vector<float> enemyRadii;
+    std::vector<Vector2> bulletPositions;
+    std::vector<Vector2> bulletPrevious; // Where each bullet was one tick earlier
+};
+
+Scene makeScene(int enemyCount, int bulletCount, float tickSeconds, unsigned seed) {
+    std::mt19937 rng(seed);
+    // Spawns reach a little past the arena edge, like the real spawner
+    std::uniform_real_distribution<float> x(-50.0f, ARENA_WIDTH + 50.0f);
+    std::uniform_real_distribution<float> y(-50.0f, ARENA_HEIGHT + 50.0f);
+    std::uniform_int_distribution<int> kind(0, 19);
+    std::uniform_real_distribution<float> angle(0.0f, 6.2831853f);
+
+    Scene scene;
+    for (int i = 0; i < enemyCount; i++) {
+        scene.enemyPositions.push_back(Vector2(x(rng), y(rng)));
+        // Mostly 26-30px regular enemies with the occasional 60px boss
+        int roll = kind(rng);
+        scene.enemyRadii.push_back(roll == 0 ? 60.0f : (roll < 8 ? 26.0f : 30.0f));
+    }
+    for (int i = 0; i < bulletCount; i++) {
+        Vector2 pos(x(rng), y(rng));
+        float heading = angle(rng);
+        Vector2 step = Vector2(std::cos(heading), std::sin(heading)) * (BULLET_SPEED * tickSeconds);
+        scene.bulletPositions.push_back(pos);
+        scene.bulletPrevious.push_back(pos - step);
+    }
+    return scene;
+}
+
+// Returns the enemy each bullet hit (-1 for a miss); every hit costs 10 of an
+// enemy's 30 health
+void runNestedLoop(const Scene& scene, std::vector<int>& hits) {
+    std::vector<int> health(scene.enemyPositions.size(), 30);
+    hits.assign(scene.bulletPositions.size(), -1);
+    for (size_t b = 0; b < scene.bulletPositions.size(); b++) {
+        for (size_t e = 0; e < scene.enemyPositions.size(); e++) {
+            if (health[e] <= 0) continue;
+            float distance = scene.bulletPositions[b].distance(scene.enemyPositions[e]);
+            if (distance < BULLET_RADIUS + scene.enemyRadii[e]) {
+                hits[b] = static_cast<int>(e);
+                health[e] -= 10;
+                break;
+            }
+        }
+    }
+}
+
+void runGrid(const Scene& scene, SpatialGrid& grid, std::vector<int>& hits) {
+    std::vector<int> health(scene.enemyPositions.size(), 30);
+    hits.assign(scene.bulletPositions.size(), -1);
+
+    grid.clear();
+    for (size_t e = 0; e < scene.enemyPositions.size(); e++) {
+        grid.insert(scene.enemyPositions[e].x, scene.enemyPositions[e].y, scene.enemyRadii[e]);
+    }
+    grid.build();
+
+    for (size_t b = 0; b < scene.bulletPositions.size(); b++) {
+        const Vector2& pos = scene.bulletPositions[b];
+        int hit = grid.queryFirst(pos.x, pos.y, BULLET_RADIUS, [&](int e) { return health[e] > 0; });
+        if (hit >= 0) {
+            hits[b] = hit;
+            health[hit] -= 10;
+        }
+    }
+}
+
+void runNestedSwept(const Scene& scene, std::vector<int>& hits) {
+    std::vector<int> health(scene.enemyPositions.size(), 30);
+    hits.assign(scene.bulletPositions.size(), -1);
+    for (size_t b = 0; b < scene.bulletPositions.size(); b++) {
+        const Vector2& from = scene.bulletPrevious[b];
+        const Vector2& to = scene.bulletPositions[b];
+        float bestTime = 2.0f;
+        for (size_t e = 0; e < scene.enemyPositions.size(); e++) {
+            if (health[e] <= 0) continue;
+            float t = sweepCircle(from.x, from.y, to.x, to.y, BULLET_RADIUS + scene.enemyRadii[e],
+                                  scene.enemyPositions[e].x, scene.enemyPositions[e].y);
+            if (t >= 0.0f && t < bestTime) {
+                bestTime = t;
+                hits[b] = static_cast<int>(e);
+            }
+        }
+        if (hits[b] >= 0) {
+            health[hits[b]] -= 10;
+        }
+    }
+}
+
+void runGridSwept(const Scene& scene, SpatialGrid& grid, std::vector<int>& hits) {
+    std::vector<int> health(scene.enemyPositions.size(), 30);
+    hits.assign(scene.bulletPositions.size(), -1);
+
+    grid.clear();
+    for (size_t e = 0; e < scene.enemyPositions.size(); e++) {
+        grid.insert(scene.enemyPositions[e].x, scene.enemyPositions[e].y, scene.enemyRadii[e]);
+    }
+    grid.build();
+
+    for (size_t b = 0; b < scene.bulletPositions.size(); b++) {
+        const Vector2& from = scene.bulletPrevious[b];
+        const Vector2& to = scene.bulletPositions[b];
+        float hitTime = 0.0f;
+        int hit = grid.querySweptFirst(from.x, from.y, to.x, to.y, BULLET_RADIUS, hitTime,
+                                       [&](int e) { return health[e] > 0; });
+        if (hit >= 0) {
+            hits[b] = hit;
+            health[hit] -= 10;
+        }
+    }
+}
+
+int countHits(const std::vector<int>& hits) {
+    int total = 0;
+    for (int hit : hits) {
+        if (hit >= 0) total++;
+    }
+    return total;
+}
+
+template <typename Fn>
+double timeMicroseconds(int iterations, Fn&& fn) {
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; i++) {
+        fn();
+    }
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    return std::chrono::duration<double, std::micro>(elapsed).count() / iterations;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    int iterations = argc > 1 ? std::max(1, std::atoi(argv[1])) : 200;
+
+    // Early wave, SMG spam, late-wave horde
+    const int cases[][2] = {{50, 200}, {200, 1000}, {500, 2000}, {1000, 4000}, {2000, 8000}};
+
+    SpatialGrid grid(ARENA_WIDTH, ARENA_HEIGHT, CELL_SIZE);
+    std::vector<int> nestedHits;
+    std::vector<int> gridHits;
+    bool allMatch = true;
+
+    std::printf("End-position test, 120 Hz tick\n");
+    std::printf("%8s %8s %14s %14s %9s %6s\n", "enemies", "bullets", "nested (us)", "grid (us)", "speedup", "match");
+    for (const auto& c : cases) {
+        Scene scene = makeScene(c[0], c[1], 1.0f / 120.0f, 1234u + c[0]);
+
+        double nestedUs = timeMicroseconds(iterations, [&]() { runNestedLoop(scene, nestedHits); });
+        double gridUs = timeMicroseconds(iterations, [&]() { runGrid(scene, grid, gridHits); });
+        bool match = nestedHits == gridHits;
+        allMatch = allMatch && match;
+
+        std::printf("%8d %8d %14.1f %14.1f %8.1fx %6s\n", c[0], c[1], nestedUs, gridUs,
+                    nestedUs / gridUs, match ? "yes" : "NO");
+    }
+
+    // Longer ticks stretch each bullet's segment; the end-position test starts
+    // missing enemies it passed through while the swept test doesn't
+    const float ticks[] = {1.0f / 120.0f, 1.0f / 30.0f, 1.0f / 10.0f};
+    std::printf("\nSwept test, 1000 enemies / 4000 bullets\n");
+    std::printf("%8s %14s %14s %9s %6s %10s %10s\n", "tick ms", "nested (us)", "grid (us)", "speedup", "match",
+                "end hits", "swept hits");
+    for (float tick : ticks) {
+        Scene scene = makeScene(1000, 4000, tick, 4321u);
+
+        double nestedUs = timeMicroseconds(iterations, [&]() { runNestedSwept(scene, nestedHits); });
+        double gridUs = timeMicroseconds(iterations, [&]() { runGridSwept(scene, grid, gridHits); });
+        bool match = nestedHits == gridHits;
+        allMatch = allMatch && match;
+        int sweptHits = countHits(gridHits);
+        runGrid(scene, grid, gridHits);
+
+        std::printf("%8.1f %14.1f %14.1f %8.1fx %6s %10d %10d\n", tick * 1000.0f, nestedUs, gridUs,
+                    nestedUs / gridUs, match ? "yes" : "NO", countHits(gridHits), sweptHits);
+    }
+
+    return allMatch ? 0 : 1;
+}
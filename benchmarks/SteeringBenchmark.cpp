@@ -0,0 +1,106 @@
+// Chase-steering kernels side by side: time per tick for each backend the CPU
+// supports, checked bit for bit against the scalar kernel after many ticks.
+//
+//     cmake -DBROTATO_BUILD_BENCHMARKS=ON ..
+//     ./SteeringBenchmark [ticks]
+#include "Steering.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <vector>
+
+namespace {
+
+using ChaseFn = void (*)(float*, float*, float*, float*, const float*, int, Vector2, float);
+
+struct Horde {
+    std::vector<float> positionX, positionY, velocityX, velocityY, speed;
+
+    Horde(int count, unsigned seed)
+        : positionX(count), positionY(count), velocityX(count), velocityY(count), speed(count) {
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution<float> x(-50.0f, 1970.0f);
+        std::uniform_real_distribution<float> y(-50.0f, 1130.0f);
+        std::uniform_real_distribution<float> s(35.0f, 80.0f);
+        for (int i = 0; i < count; i++) {
+            positionX[i] = x(rng);
+            positionY[i] = y(rng);
+            speed[i] = s(rng);
+        }
+        // One agent sitting exactly on the target exercises the zero-length case
+        positionX[0] = 960.0f;
+        positionY[0] = 540.0f;
+    }
+
+    bool operator==(const Horde& other) const {
+        auto same = [](const std::vector<float>& a, const std::vector<float>& b) {
+            return std::memcmp(a.data(), b.data(), a.size() * sizeof(float)) == 0;
+        };
+        return same(positionX, other.positionX) && same(positionY, other.positionY) &&
+               same(velocityX, other.velocityX) && same(velocityY, other.velocityY);
+    }
+};
+
+// Player circling the arena center so the target moves every tick
+Vector2 targetAt(int tick) {
+    float angle = tick * 0.01f;
+    return Vector2(960.0f + 300.0f * std::cos(angle), 540.0f + 300.0f * std::sin(angle));
+}
+
+double runTicks(ChaseFn chase, Horde& horde, int ticks) {
+    const float deltaTime = 1.0f / 120.0f;
+    int count = static_cast<int>(horde.speed.size());
+    auto start = std::chrono::steady_clock::now();
+    for (int tick = 0; tick < ticks; tick++) {
+        chase(horde.positionX.data(), horde.positionY.data(), horde.velocityX.data(), horde.velocityY.data(),
+              horde.speed.data(), count, targetAt(tick), deltaTime);
+    }
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    return std::chrono::duration<double, std::micro>(elapsed).count() / ticks;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    int ticks = argc > 1 ? std::max(1, std::atoi(argv[1])) : 600;
+
+    struct Kernel {
+        const char* name;
+        Steering::Backend backend;
+        ChaseFn fn;
+    };
+    const Kernel kernels[] = {
+        {"scalar", Steering::Backend::SCALAR, &Steering::chaseScalar},
+        {"sse2", Steering::Backend::SSE2, &Steering::chaseSse2},
+        {"avx2", Steering::Backend::AVX2, &Steering::chaseAvx2},
+    };
+
+    std::printf("Dispatch picks: %s\n", Steering::getBackendName());
+    std::printf("%8s %8s %12s %9s %13s  %s\n", "agents", "kernel", "us / tick", "speedup", "of 2ms budget", "matches scalar");
+
+    bool allMatch = true;
+    const int counts[] = {1000, 10000, 50000, 100003};
+    for (int count : counts) {
+        Horde reference(count, 99u);
+        double scalarUs = runTicks(&Steering::chaseScalar, reference, ticks);
+
+        for (const Kernel& kernel : kernels) {
+            if (!Steering::isSupported(kernel.backend)) {
+                std::printf("%8d %8s %12s\n", count, kernel.name, "unsupported");
+                continue;
+            }
+            Horde horde(count, 99u);
+            double us = runTicks(kernel.fn, horde, ticks);
+            bool match = horde == reference;
+            allMatch = allMatch && match;
+            std::printf("%8d %8s %12.1f %8.1fx %12.1f%%  %s\n", count, kernel.name, us, scalarUs / us,
+                        us / 2000.0 * 100.0, match ? "yes" : "NO");
+        }
+    }
+
+    return allMatch ? 0 : 1;
+}
@@ -0,0 +1,112 @@
+// VectorMath batch kernels against their scalar reference loops. Checks that
+// normalize/distance match the scalar results bit for bit and reports the
+// worst error of the approximate normalizeFast.
+//
+//     cmake -DBROTATO_BUILD_BENCHMARKS=ON ..
+//     ./VectorMathBenchmark [iterations]
+#include "VectorMath.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <vector>
+
+namespace {
+
+template <typename Fn>
+double timeMicroseconds(int iterations, Fn&& fn) {
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; i++) {
+        fn();
+    }
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    return std::chrono::duration<double, std::micro>(elapsed).count() / iterations;
+}
+
+bool sameBits(const std::vector<float>& a, const std::vector<float>& b) {
+    return std::memcmp(a.data(), b.data(), a.size() * sizeof(float)) == 0;
+}
+
+void printRow(const char* name, int count, double scalarUs, double simdUs, const char* check) {
+    std::printf("%-16s %8d %12.2f %12.2f %8.1fx  %s\n", name, count, scalarUs, simdUs, scalarUs / simdUs, check);
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    int iterations = argc > 1 ? std::max(1, std::atoi(argv[1])) : 2000;
+    bool allMatch = true;
+
+    std::printf("Backend: %s\n", VectorMath::getBackendName());
+    std::printf("%-16s %8s %12s %12s %9s  %s\n", "kernel", "count", "scalar (us)", "batch (us)", "speedup", "check");
+
+    // Bullet- and horde-sized arrays; odd sizes exercise the scalar tail
+    const int counts[] = {1023, 8192, 65537};
+    std::mt19937 rng(42);
+    std::uniform_real_distribution<float> coordinate(-2000.0f, 2000.0f);
+
+    for (int count : counts) {
+        std::vector<float> x(count);
+        std::vector<float> y(count);
+        for (int i = 0; i < count; i++) {
+            x[i] = coordinate(rng);
+            y[i] = coordinate(rng);
+        }
+        x[0] = 0.0f; // Zero-length vector must normalize to (0, 0)
+        y[0] = 0.0f;
+
+        std::vector<float> scalarX(count), scalarY(count), batchX(count), batchY(count);
+        Vector2 point(960.0f, 540.0f);
+
+        double scalarUs = timeMicroseconds(iterations, [&]() {
+            VectorMath::normalizeScalar(x.data(), y.data(), scalarX.data(), scalarY.data(), count);
+        });
+        double batchUs = timeMicroseconds(iterations, [&]() {
+            VectorMath::normalize(x.data(), y.data(), batchX.data(), batchY.data(), count);
+        });
+        bool match = sameBits(scalarX, batchX) && sameBits(scalarY, batchY);
+        allMatch = allMatch && match;
+        printRow("normalize", count, scalarUs, batchUs, match ? "bit-identical" : "MISMATCH");
+
+        scalarUs = timeMicroseconds(iterations, [&]() {
+            VectorMath::normalizeFastScalar(x.data(), y.data(), scalarX.data(), scalarY.data(), count);
+        });
+        batchUs = timeMicroseconds(iterations, [&]() {
+            VectorMath::normalizeFast(x.data(), y.data(), batchX.data(), batchY.data(), count);
+        });
+        float worst = 0.0f;
+        for (int i = 0; i < count; i++) {
+            Vector2 exact = Vector2(x[i], y[i]).normalized();
+            worst = std::max(worst, std::max(std::fabs(batchX[i] - exact.x), std::fabs(batchY[i] - exact.y)));
+        }
+        char check[64];
+        std::snprintf(check, sizeof(check), "max error %.2e", worst);
+        printRow("normalizeFast", count, scalarUs, batchUs, check);
+
+        std::vector<float> scalarOut(count), batchOut(count);
+        scalarUs = timeMicroseconds(iterations, [&]() {
+            VectorMath::distanceScalar(x.data(), y.data(), point, scalarOut.data(), count);
+        });
+        batchUs = timeMicroseconds(iterations, [&]() {
+            VectorMath::distance(x.data(), y.data(), point, batchOut.data(), count);
+        });
+        match = sameBits(scalarOut, batchOut);
+        allMatch = allMatch && match;
+        printRow("distance", count, scalarUs, batchUs, match ? "bit-identical" : "MISMATCH");
+
+        scalarUs = timeMicroseconds(iterations, [&]() {
+            VectorMath::distanceSquaredScalar(x.data(), y.data(), point, scalarOut.data(), count);
+        });
+        batchUs = timeMicroseconds(iterations, [&]() {
+            VectorMath::distanceSquared(x.data(), y.data(), point, batchOut.data(), count);
+        });
+        match = sameBits(scalarOut, batchOut);
+        allMatch = allMatch && match;
+        printRow("distanceSquared", count, scalarUs, batchUs, match ? "bit-identical" : "MISMATCH");
+    }
+
+    return allMatch ? 0 : 1;
+}
@@ -0,0 +1,429 @@
+#include "AllocationTracker.h"
+
+#ifdef BROTATO_TRACK_ALLOCATIONS
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#pragma intrinsic(_ReturnAddress)
+#define ALLOC_RETURN_ADDRESS() _ReturnAddress()
+#else
+#define ALLOC_RETURN_ADDRESS() __builtin_return_address(0)
+#endif
+
+namespace {
+
+// Everything below is plain data with constant initialisation: operator new can
+// run before any dynamic initialiser (and after static destructors), so the
+// tracker must never depend on constructed objects.
+
+struct Subsystem {
+    const char* name;
+    uint64_t frameAllocations;
+    uint64_t frameBytes;
+    uint64_t lastAllocations;
+    uint64_t lastBytes;
+    uint64_t totalAllocations;
+    uint64_t totalBytes;
+};
+
+struct Site {
+    const void* address;
+    const char* subsystem;
+    uint64_t allocations;
+    uint64_t bytes;
+};
+
+// Prefix written in front of every block so delete knows the size and the
+// pointer malloc returned (they differ for over-aligned allocations)
+struct BlockHeader {
+    void* base;
+    size_t size;
+};
+
+const size_t HEADER_ALIGN = 16;
+static_assert(sizeof(BlockHeader) <= HEADER_ALIGN, "block header must fit in the default alignment");
+
+std::atomic_flag lock = ATOMIC_FLAG_INIT;
+
+uint64_t frameAllocations = 0;
+uint64_t frameFrees = 0;
+uint64_t frameBytes = 0;
+AllocationTracker::FrameStats lastFrame;
+uint64_t frameNumber = 0;
+
+uint64_t liveBytes = 0;
+uint64_t peakLiveBytes = 0;
+uint64_t totalAllocations = 0;
+int budgetViolations = 0;
+
+Subsystem subsystems[AllocationTracker::MAX_SUBSYSTEMS];
+int subsystemCount = 0;
+Site sites[AllocationTracker::MAX_SITES];
+int siteCount = 0;
+uint64_t droppedSites = 0;
+
+FILE* logFile = nullptr;
+
+thread_local const char* currentScope = nullptr;
+thread_local uint64_t threadAllocations = 0;
+
+const char* const UNSCOPED = "(unscoped)";
+
+class LockGuard {
+public:
+    LockGuard() {
+        while (lock.test_and_set(std::memory_order_acquire)) {
+        }
+    }
+    ~LockGuard() { lock.clear(std::memory_order_release); }
+};
+
+Subsystem* findSubsystem(const char* name) {
+    for (int i = 0; i < subsystemCount; i++) {
+        if (subsystems[i].name == name) {
+            return &subsystems[i];
+        }
+    }
+    if (subsystemCount < AllocationTracker::MAX_SUBSYSTEMS) {
+        Subsystem& entry = subsystems[subsystemCount++];
+        entry.name = name;
+        return &entry;
+    }
+    return nullptr;
+}
+
+Site* findSite(const void* address, const char* scope) {
+    // Open addressing on the return address; the table never shrinks
+    size_t hash = reinterpret_cast<uintptr_t>(address);
+    hash ^= hash >> 17;
+    hash *= 0x9E3779B1u;
+    for (int probe = 0; probe < AllocationTracker::MAX_SITES; probe++) {
+        Site& site = sites[(hash + probe) % AllocationTracker::MAX_SITES];
+        if (site.address == address) {
+            return &site;
+        }
+        if (!site.address) {
+            site.address = address;
+            site.subsystem = scope;
+            siteCount++;
+            return &site;
+        }
+    }
+    return nullptr;
+}
+
+void recordAllocation(size_t size, const void* caller) {
+    threadAllocations++;
+    const char* scope = currentScope ? currentScope : UNSCOPED;
+
+    LockGuard guard;
+    frameAllocations++;
+    frameBytes += size;
+    totalAllocations++;
+    liveBytes += size;
+    peakLiveBytes = std::max(peakLiveBytes, liveBytes);
+
+    if (Subsystem* subsystem = findSubsystem(scope)) {
+        subsystem->frameAllocations++;
+        subsystem->frameBytes += size;
+        subsystem->totalAllocations++;
+        subsystem->totalBytes += size;
+    }
+
+    if (Site* site = findSite(caller, scope)) {
+        site->allocations++;
+        site->bytes += size;
+    } else {
+        droppedSites++;
+    }
+}
+
+void recordFree(size_t size) {
+    LockGuard guard;
+    frameFrees++;
+    liveBytes -= size;
+}
+
+void* trackedAlloc(size_t size, size_t align, const void* caller) {
+    if (align < HEADER_ALIGN) align = HEADER_ALIGN;
+
+    // Reserve one alignment unit in front of the block for the header
+    void* base = std::malloc(size + align);
+    if (!base) return nullptr;
+
+    uintptr_t user = (reinterpret_cast<uintptr_t>(base) + sizeof(BlockHeader) + align - 1) & ~(align - 1);
+    BlockHeader* header = reinterpret_cast<BlockHeader*>(user) - 1;
+    header->base = base;
+    header->size = size;
+
+    recordAllocation(size, caller);
+    return reinterpret_cast<void*>(user);
+}
+
+void trackedFree(void* ptr) {
+    if (!ptr) return;
+    BlockHeader* header = static_cast<BlockHeader*>(ptr) - 1;
+    recordFree(header->size);
+    std::free(header->base);
+}
+
+void* allocOrThrow(size_t size, size_t align, const void* caller) {
+    if (size == 0) size = 1;
+    void* ptr = trackedAlloc(size, align, caller);
+    if (!ptr) throw std::bad_alloc();
+    return ptr;
+}
+
+void* allocNoThrow(size_t size, size_t align, const void* caller) noexcept {
+    if (size == 0) size = 1;
+    return trackedAlloc(size, align, caller);
+}
+
+} // namespace
+
+// Global operator new/delete replacements. Every form funnels into the two
+// helpers above; the sized and aligned delete overloads ignore their extra
+// arguments because the header already records the size and base pointer.
+
+void* operator new(size_t size) { return allocOrThrow(size, 0, ALLOC_RETURN_ADDRESS()); }
+void* operator new[](size_t size) { return allocOrThrow(size, 0, ALLOC_RETURN_ADDRESS()); }
+void* operator new(size_t size, const std::nothrow_t&) noexcept { return allocNoThrow(size, 0, ALLOC_RETURN_ADDRESS()); }
+void* operator new[](size_t size, const std::nothrow_t&) noexcept { return allocNoThrow(size, 0, ALLOC_RETURN_ADDRESS()); }
+void* operator new(size_t size, std::align_val_t align) {
+    return allocOrThrow(size, static_cast<size_t>(align), ALLOC_RETURN_ADDRESS());
+}
+void* operator new[](size_t size, std::align_val_t align) {
+    return allocOrThrow(size, static_cast<size_t>(align), ALLOC_RETURN_ADDRESS());
+}
+void* operator new(size_t size, std::align_val_t align, const std::nothrow_t&) noexcept {
+    return allocNoThrow(size, static_cast<size_t>(align), ALLOC_RETURN_ADDRESS());
+}
+void* operator new[](size_t size, std::align_val_t align, const std::nothrow_t&) noexcept {
+    return allocNoThrow(size, static_cast<size_t>(align), ALLOC_RETURN_ADDRESS());
+}
+
+void operator delete(void* ptr) noexcept { trackedFree(ptr); }
+void operator delete[](void* ptr) noexcept { trackedFree(ptr); }
+void operator delete(void* ptr, size_t) noexcept { trackedFree(ptr); }
+void operator delete[](void* ptr, size_t) noexcept { trackedFree(ptr); }
+void operator delete(void* ptr, const std::nothrow_t&) noexcept { trackedFree(ptr); }
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept { trackedFree(ptr); }
+void operator delete(void* ptr, std::align_val_t) noexcept { trackedFree(ptr); }
+void operator delete[](void* ptr, std::align_val_t) noexcept { trackedFree(ptr); }
+void operator delete(void* ptr, size_t, std::align_val_t) noexcept { trackedFree(ptr); }
+void operator delete[](void* ptr, size_t, std::align_val_t) noexcept { trackedFree(ptr); }
+void operator delete(void* ptr, std::align_val_t, const std::nothrow_t&) noexcept { trackedFree(ptr); }
+void operator delete[](void* ptr, std::align_val_t, const std::nothrow_t&) noexcept { trackedFree(ptr); }
+
+void AllocationTracker::beginFrame() {
+    LockGuard guard;
+    frameAllocations = 0;
+    frameFrees = 0;
+    frameBytes = 0;
+    for (int i = 0; i < subsystemCount; i++) {
+        subsystems[i].frameAllocations = 0;
+        subsystems[i].frameBytes = 0;
+    }
+}
+
+void AllocationTracker::endFrame() {
+    FrameStats frame;
+    uint64_t live = 0;
+    uint64_t number = 0;
+    {
+        LockGuard guard;
+        lastFrame.allocations = frameAllocations;
+        lastFrame.frees = frameFrees;
+        lastFrame.bytes = frameBytes;
+        for (int i = 0; i < subsystemCount; i++) {
+            subsystems[i].lastAllocations = subsystems[i].frameAllocations;
+            subsystems[i].lastBytes = subsystems[i].frameBytes;
+        }
+        frame = lastFrame;
+        live = liveBytes;
+        number = ++frameNumber;
+    }
+
+    // One summary line per second of frames keeps the log readable
+    if (logFile && number % 60 == 0) {
+        std::fprintf(logFile, "frame %llu: %llu allocs, %llu frees, %llu bytes, %llu live\n",
+                     static_cast<unsigned long long>(number), static_cast<unsigned long long>(frame.allocations),
+                     static_cast<unsigned long long>(frame.frees), static_cast<unsigned long long>(frame.bytes),
+                     static_cast<unsigned long long>(live));
+    }
+}
+
+AllocationTracker::FrameStats AllocationTracker::getLastFrame() {
+    LockGuard guard;
+    return lastFrame;
+}
+
+uint64_t AllocationTracker::getLiveBytes() {
+    LockGuard guard;
+    return liveBytes;
+}
+
+uint64_t AllocationTracker::getPeakLiveBytes() {
+    LockGuard guard;
+    return peakLiveBytes;
+}
+
+uint64_t AllocationTracker::getTotalAllocations() {
+    LockGuard guard;
+    return totalAllocations;
+}
+
+int AllocationTracker::getBudgetViolations() {
+    LockGuard guard;
+    return budgetViolations;
+}
+
+int AllocationTracker::getSubsystems(SubsystemStats* out, int maxCount) {
+    LockGuard guard;
+    int count = std::min(maxCount, subsystemCount);
+    for (int i = 0; i < count; i++) {
+        out[i] = {subsystems[i].name, subsystems[i].lastAllocations, subsystems[i].lastBytes,
+                  subsystems[i].totalAllocations, subsystems[i].totalBytes};
+    }
+    return count;
+}
+
+int AllocationTracker::getTopSites(SiteStats* out, int maxCount) {
+    // Copy under the lock, sort outside it; std::sort works in place and
+    // doesn't allocate
+    static Site snapshot[MAX_SITES];
+    int count = 0;
+    {
+        LockGuard guard;
+        for (int i = 0; i < MAX_SITES; i++) {
+            if (sites[i].address) {
+                snapshot[count++] = sites[i];
+            }
+        }
+    }
+
+    int wanted = std::min(maxCount, count);
+    std::partial_sort(snapshot, snapshot + wanted, snapshot + count,
+                      [](const Site& a, const Site& b) { return a.allocations > b.allocations; });
+    for (int i = 0; i < wanted; i++) {
+        out[i] = {snapshot[i].address, snapshot[i].subsystem, snapshot[i].allocations, snapshot[i].bytes};
+    }
+    return wanted;
+}
+
+bool AllocationTracker::openLog(const char* path) {
+    closeLog();
+    logFile = std::fopen(path, "w");
+    if (!logFile) {
+        std::cout << "Unable to open allocation log " << path << std::endl;
+        return false;
+    }
+    std::fprintf(logFile, "allocation tracking enabled\n");
+    return true;
+}
+
+void AllocationTracker::writeReport() {
+    if (!logFile) return;
+
+    std::fprintf(logFile, "\n== allocation report ==\n");
+    std::fprintf(logFile, "frames: %llu  total allocations: %llu  live bytes: %llu  peak live bytes: %llu\n",
+                 static_cast<unsigned long long>(frameNumber), static_cast<unsigned long long>(getTotalAllocations()),
+                 static_cast<unsigned long long>(getLiveBytes()), static_cast<unsigned long long>(getPeakLiveBytes()));
+    std::fprintf(logFile, "budget violations: %d\n", getBudgetViolations());
+
+    static SubsystemStats subsystemStats[MAX_SUBSYSTEMS];
+    int subsystemTotal = getSubsystems(subsystemStats, MAX_SUBSYSTEMS);
+    std::fprintf(logFile, "\nsubsystem                     allocs          bytes\n");
+    for (int i = 0; i < subsystemTotal; i++) {
+        std::fprintf(logFile, "%-24s %12llu %14llu\n", subsystemStats[i].name,
+                     static_cast<unsigned long long>(subsystemStats[i].totalAllocations),
+                     static_cast<unsigned long long>(subsystemStats[i].totalBytes));
+    }
+
+    // Addresses resolve to source lines with addr2line / the debugger
+    static SiteStats siteStats[32];
+    int siteTotal = getTopSites(siteStats, 32);
+    std::fprintf(logFile, "\ntop call sites               allocs          bytes  subsystem\n");
+    for (int i = 0; i < siteTotal; i++) {
+        std::fprintf(logFile, "%-18p %17llu %14llu  %s\n", siteStats[i].address,
+                     static_cast<unsigned long long>(siteStats[i].allocations),
+                     static_cast<unsigned long long>(siteStats[i].bytes), siteStats[i].subsystem);
+    }
+    if (droppedSites > 0) {
+        std::fprintf(logFile, "(%llu allocations from sites beyond the %d-entry table)\n",
+                     static_cast<unsigned long long>(droppedSites), MAX_SITES);
+    }
+    std::fflush(logFile);
+}
+
+void AllocationTracker::closeLog() {
+    if (logFile) {
+        std::fclose(logFile);
+        logFile = nullptr;
+    }
+}
+
+const char* AllocationTracker::pushScope(const char* name) {
+    const char* previous = currentScope;
+    currentScope = name;
+    return previous;
+}
+
+void AllocationTracker::popScope(const char* previous) {
+    currentScope = previous;
+}
+
+uint64_t AllocationTracker::getThreadAllocationCount() {
+    return threadAllocations;
+}
+
+void AllocationTracker::reportBudget(const char* name, uint64_t allocations, uint64_t budget) {
+    int violations = 0;
+    uint64_t number = 0;
+    {
+        LockGuard guard;
+        violations = ++budgetViolations;
+        number = frameNumber;
+    }
+
+    if (violations == 1) {
+        std::cout << "Allocation budget exceeded: " << name << " made " << allocations
+                  << " allocations (budget " << budget << "), see the allocation log" << std::endl;
+    }
+    if (logFile) {
+        std::fprintf(logFile, "frame %llu: budget '%s' exceeded, %llu allocations (budget %llu)\n",
+                     static_cast<unsigned long long>(number), name, static_cast<unsigned long long>(allocations),
+                     static_cast<unsigned long long>(budget));
+    }
+}
+
+#else
+
+// Tracking compiled out: keep the API so callers (and the F5 panel) don't need
+// their own #ifdefs
+
+void AllocationTracker::beginFrame() {}
+void AllocationTracker::endFrame() {}
+AllocationTracker::FrameStats AllocationTracker::getLastFrame() { return FrameStats(); }
+uint64_t AllocationTracker::getLiveBytes() { return 0; }
+uint64_t AllocationTracker::getPeakLiveBytes() { return 0; }
+uint64_t AllocationTracker::getTotalAllocations() { return 0; }
+int AllocationTracker::getBudgetViolations() { return 0; }
+int AllocationTracker::getSubsystems(SubsystemStats*, int) { return 0; }
+int AllocationTracker::getTopSites(SiteStats*, int) { return 0; }
+bool AllocationTracker::openLog(const char*) { return false; }
+void AllocationTracker::writeReport() {}
+void AllocationTracker::closeLog() {}
+const char* AllocationTracker::pushScope(const char*) { return nullptr; }
+void AllocationTracker::popScope(const char*) {}
+uint64_t AllocationTracker::getThreadAllocationCount() { return 0; }
+void AllocationTracker::reportBudget(const char*, uint64_t, uint64_t) {}
+
+#endif
@@ -0,0 +1,119 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+// Opt-in heap allocation tracker. Configure with
+//     cmake -DBROTATO_TRACK_ALLOCATIONS=ON
+// to replace global operator new/delete. Every allocation is tagged with the
+// innermost ALLOC_SCOPE on the calling thread and its call site (the return
+// address into the code that called new). In normal builds the macros expand
+// to nothing and the queries return zeros.
+//
+//     void Game::update(float deltaTime) {
+//         ALLOC_SCOPE("simulation");
+//         ALLOC_BUDGET("simulation tick", 0);   // logs when the tick allocates
+//         ...
+//     }
+class AllocationTracker {
+public:
+#ifdef BROTATO_TRACK_ALLOCATIONS
+    static constexpr bool ENABLED = true;
+#else
+    static constexpr bool ENABLED = false;
+#endif
+
+    static const int MAX_SUBSYSTEMS = 32;
+    static const int MAX_SITES = 1024;
+
+    struct FrameStats {
+        uint64_t allocations = 0;
+        uint64_t frees = 0;
+        uint64_t bytes = 0;
+    };
+
+    struct SubsystemStats {
+        const char* name;
+        uint64_t frameAllocations; // Last completed frame
+        uint64_t frameBytes;
+        uint64_t totalAllocations;
+        uint64_t totalBytes;
+    };
+
+    struct SiteStats {
+        const void* address;   // Return address into the allocating code
+        const char* subsystem; // Scope active the first time the site was seen
+        uint64_t allocations;
+        uint64_t bytes;
+    };
+
+    // Frame boundaries: per-frame counters roll over in endFrame()
+    static void beginFrame();
+    static void endFrame();
+
+    static FrameStats getLastFrame();
+    static uint64_t getLiveBytes();
+    static uint64_t getPeakLiveBytes();
+    static uint64_t getTotalAllocations();
+    static int getBudgetViolations();
+
+    // Copies out up to maxCount entries; returns how many were written
+    static int getSubsystems(SubsystemStats* out, int maxCount);
+    // Sites with the most allocations since startup, highest first
+    static int getTopSites(SiteStats* out, int maxCount);
+
+    // Log file gets a summary line once per second, every budget violation and
+    // a full report from writeReport() (called at shutdown)
+    static bool openLog(const char* path);
+    static void writeReport();
+    static void closeLog();
+
+    // Used by the scope macros
+    static const char* pushScope(const char* name);
+    static void popScope(const char* previous);
+    static uint64_t getThreadAllocationCount();
+    static void reportBudget(const char* name, uint64_t allocations, uint64_t budget);
+};
+
+class AllocationScope {
+public:
+    explicit AllocationScope(const char* name) : previous(AllocationTracker::pushScope(name)) {}
+    ~AllocationScope() { AllocationTracker::popScope(previous); }
+
+    AllocationScope(const AllocationScope&) = delete;
+    AllocationScope& operator=(const AllocationScope&) = delete;
+
+private:
+    const char* previous;
+};
+
+// Logs a violation when the enclosing block makes more than `budget`
+// allocations on this thread
+class AllocationBudget {
+public:
+    AllocationBudget(const char* budgetName, uint64_t maxAllocations)
+        : name(budgetName), budget(maxAllocations), start(AllocationTracker::getThreadAllocationCount()) {}
+    ~AllocationBudget() {
+        uint64_t made = AllocationTracker::getThreadAllocationCount() - start;
+        if (made > budget) {
+            AllocationTracker::reportBudget(name, made, budget);
+        }
+    }
+
+    AllocationBudget(const AllocationBudget&) = delete;
+    AllocationBudget& operator=(const AllocationBudget&) = delete;
+
+private:
+    const char* name;
+    uint64_t budget;
+    uint64_t start;
+};
+
+#ifdef BROTATO_TRACK_ALLOCATIONS
+#define ALLOC_CONCAT_INNER(a, b) a##b
+#define ALLOC_CONCAT(a, b) ALLOC_CONCAT_INNER(a, b)
+#define ALLOC_SCOPE(name) AllocationScope ALLOC_CONCAT(allocScope_, __LINE__)(name)
+#define ALLOC_BUDGET(name, budget) AllocationBudget ALLOC_CONCAT(allocBudget_, __LINE__)(name, budget)
+#else
+#define ALLOC_SCOPE(name) ((void)0)
+#define ALLOC_BUDGET(name, budget) ((void)0)
+#endif
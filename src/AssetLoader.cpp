@@ -0,0 +1,170 @@
+#include "AssetLoader.h"
+#include <algorithm>
+#include <condition_variable>
+#include <cstdint>
+#include <iostream>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace {
+struct Request {
+    AssetPriority priority;
+    uint64_t sequence;  // Keeps requests of equal priority in submission order
+    AssetLoader::DecodeFn decode;
+    AssetLoader::UploadFn upload;
+    SDL_Surface* surface;
+    std::promise<bool> done;
+};
+
+// Heap order: the front is the highest priority, oldest request
+bool laterThan(const Request& a, const Request& b) {
+    if (a.priority != b.priority) return a.priority > b.priority;
+    return a.sequence > b.sequence;
+}
+
+struct LoaderState {
+    std::mutex mutex;
+    std::condition_variable wake;
+    std::vector<Request> decodeQueue;  // Heap, see laterThan
+    std::vector<Request> uploadQueue;  // Heap, decoded and waiting for the main thread
+    std::vector<std::thread> workers;
+    uint64_t nextSequence = 0;
+    int decoding = 0;
+    bool running = false;
+    bool stopping = false;
+};
+
+LoaderState& state() {
+    static LoaderState loader;
+    return loader;
+}
+
+void pushRequest(std::vector<Request>& heap, Request&& request) {
+    heap.push_back(std::move(request));
+    std::push_heap(heap.begin(), heap.end(), laterThan);
+}
+
+Request popRequest(std::vector<Request>& heap) {
+    std::pop_heap(heap.begin(), heap.end(), laterThan);
+    Request request = std::move(heap.back());
+    heap.pop_back();
+    return request;
+}
+
+void workerLoop() {
+    LoaderState& loader = state();
+    std::unique_lock<std::mutex> lock(loader.mutex);
+    while (true) {
+        loader.wake.wait(lock, [&loader] { return loader.stopping || !loader.decodeQueue.empty(); });
+        if (loader.stopping) return;
+        Request request = popRequest(loader.decodeQueue);
+        loader.decoding++;
+        lock.unlock();
+
+        request.surface = request.decode();
+
+        lock.lock();
+        loader.decoding--;
+        pushRequest(loader.uploadQueue, std::move(request));
+    }
+}
+}
+
+void AssetLoader::start(int threadCount) {
+    LoaderState& loader = state();
+    std::lock_guard<std::mutex> lock(loader.mutex);
+    if (loader.running) return;
+
+    loader.stopping = false;
+    loader.running = true;
+    threadCount = std::max(1, threadCount);
+    for (int i = 0; i < threadCount; i++) {
+        loader.workers.emplace_back(workerLoop);
+    }
+    std::cout << "Asset loader started with " << threadCount << " thread(s)" << std::endl;
+}
+
+void AssetLoader::stop() {
+    LoaderState& loader = state();
+    {
+        std::lock_guard<std::mutex> lock(loader.mutex);
+        if (!loader.running) return;
+        loader.stopping = true;
+    }
+    loader.wake.notify_all();
+    for (auto& worker : loader.workers) {
+        worker.join();
+    }
+    loader.workers.clear();
+
+    std::lock_guard<std::mutex> lock(loader.mutex);
+    for (Request& request : loader.decodeQueue) {
+        request.done.set_value(false);
+    }
+    for (Request& request : loader.uploadQueue) {
+        if (request.surface) SDL_FreeSurface(request.surface);
+        request.done.set_value(false);
+    }
+    loader.decodeQueue.clear();
+    loader.uploadQueue.clear();
+    loader.running = false;
+}
+
+bool AssetLoader::isRunning() {
+    LoaderState& loader = state();
+    std::lock_guard<std::mutex> lock(loader.mutex);
+    return loader.running;
+}
+
+std::shared_future<bool> AssetLoader::submit(AssetPriority priority, DecodeFn decode, UploadFn upload) {
+    LoaderState& loader = state();
+
+    Request request;
+    request.priority = priority;
+    request.decode = std::move(decode);
+    request.upload = std::move(upload);
+    request.surface = nullptr;
+    std::shared_future<bool> future = request.done.get_future().share();
+
+    std::unique_lock<std::mutex> lock(loader.mutex);
+    request.sequence = loader.nextSequence++;
+    if (loader.running) {
+        pushRequest(loader.decodeQueue, std::move(request));
+        lock.unlock();
+        loader.wake.notify_one();
+        return future;
+    }
+    lock.unlock();
+
+    request.surface = request.decode();
+    lock.lock();
+    pushRequest(loader.uploadQueue, std::move(request));
+    return future;
+}
+
+int AssetLoader::uploadPending(float budgetMs) {
+    LoaderState& loader = state();
+    Uint64 start = SDL_GetPerformanceCounter();
+    double budgetTicks = static_cast<double>(budgetMs) * 0.001 * static_cast<double>(SDL_GetPerformanceFrequency());
+
+    int uploaded = 0;
+    std::unique_lock<std::mutex> lock(loader.mutex);
+    while (!loader.uploadQueue.empty()) {
+        Request request = popRequest(loader.uploadQueue);
+        lock.unlock();
+
+        request.done.set_value(request.upload(request.surface));
+        uploaded++;
+
+        if (static_cast<double>(SDL_GetPerformanceCounter() - start) >= budgetTicks) break;
+        lock.lock();
+    }
+    return uploaded;
+}
+
+int AssetLoader::getPendingCount() {
+    LoaderState& loader = state();
+    std::lock_guard<std::mutex> lock(loader.mutex);
+    return static_cast<int>(loader.decodeQueue.size() + loader.uploadQueue.size()) + loader.decoding;
+}
@@ -0,0 +1,46 @@
+#pragma once
+#include <SDL2/SDL.h>
+#include <functional>
+#include <future>
+
+// Lower values are decoded and uploaded first
+enum class AssetPriority {
+    HIGH = 0,    // Needed for the very next frames (menu fonts)
+    NORMAL = 1,  // Needed once a run starts (player, enemies, HUD)
+    LOW = 2      // Prefetch (shop art, weapons you might buy, bosses)
+};
+
+// Streams assets in two halves. `decode` runs on a loader thread and produces
+// a surface (IMG_Load, glyph rasterizing); `upload` runs on the main thread
+// inside uploadPending() and turns it into a texture, since SDL textures may
+// only be created there. `upload` owns the surface (null if decoding failed)
+// and its result completes the asset's future.
+//
+// The loader has its own threads rather than using the JobSystem so a slow
+// decode never holds up a simulation phase.
+class AssetLoader {
+public:
+    using DecodeFn = std::function<SDL_Surface*()>;
+    using UploadFn = std::function<bool(SDL_Surface*)>;
+
+    static void start(int threadCount = 2);
+
+    // Joins the loader threads. Work that hasn't been uploaded yet is dropped
+    // and its future resolves to false. Call before clearing the caches the
+    // decode functions write into.
+    static void stop();
+
+    static bool isRunning();
+
+    // Safe from any thread. While the loader isn't running the decode happens
+    // inline, but the upload still waits for uploadPending().
+    static std::shared_future<bool> submit(AssetPriority priority, DecodeFn decode, UploadFn upload);
+
+    // Main thread, once per frame: uploads decoded assets, highest priority
+    // first, until `budgetMs` is spent. Always uploads at least one so a
+    // large texture can't stall the queue. Returns how many were uploaded.
+    static int uploadPending(float budgetMs);
+
+    // Assets queued, decoding or waiting for upload
+    static int getPendingCount();
+};
@@ -1,14 +1,13 @@
 #include "BossEnemy.h"
-#include "Bullet.h"
-#include <SDL2/SDL_image.h>
+#include "SpawnQueue.h"
 #include <cmath>
 #include <iostream>
 
 BossEnemy::BossEnemy(Vector2 pos, SDL_Renderer* renderer, int currentWave)
-    : Enemy(pos, renderer), spawnWave(currentWave), currentState(BossState::HUNTING),
+    : Enemy(pos), spawnWave(currentWave), currentState(BossState::HUNTING),
       stateTimer(0.0f), stateDuration(1.0f), targetPosition(pos),
       currentAttackType(BossAttackType::SINGLE_SHOT), attackCooldown(0.3f),
-      timeSinceLastAttack(0.0f), attackCounter(0), bossTexture(nullptr) {
+      timeSinceLastAttack(0.0f), attackCounter(0) {
     
     // Scale characteristics based on wave
     maxHealth = 300 + (currentWave * 75);  // 375 on wave 1, 450 on wave 2, etc.
@@ -23,23 +22,11 @@ BossEnemy::BossEnemy(Vector2 pos, SDL_Renderer* renderer, int currentWave)
 }
 
 BossEnemy::~BossEnemy() {
-    if (bossTexture) {
-        SDL_DestroyTexture(bossTexture);
-    }
+    // Boss sprite is shared through SpriteAtlas
 }
 
 void BossEnemy::loadBossSprites(SDL_Renderer* renderer) {
-    SDL_Surface* surface = IMG_Load("assets/enemies/rix.png");
-    if (!surface) {
-        std::cout << "Failed to load rix.png: " << IMG_GetError() << std::endl;
-        bossTexture = nullptr;
-        return;
-    }
-    bossTexture = SDL_CreateTextureFromSurface(renderer, surface);
-    SDL_FreeSurface(surface);
-    if (!bossTexture) {
-        std::cout << "Failed to create boss texture: " << SDL_GetError() << std::endl;
-    }
+    bossTexture = SpriteAtlas::get(renderer, "assets/enemies/rix.png");
 }
 
 void BossEnemy::updateBossState(float deltaTime, Vector2 playerPos) {
@@ -111,8 +98,8 @@ void BossEnemy::updateMovement(float deltaTime, Vector2 playerPos) {
         }
         
         case BossState::ATTACKING:
-            // Slows down during attack
-            velocity = velocity * 0.3f;
+            // Slows down during attack (was 0.3x per 60 Hz frame, kept tick-rate independent)
+            velocity = velocity * std::pow(0.3f, deltaTime * 60.0f);
             break;
             
         case BossState::RETREATING:
@@ -132,7 +119,7 @@ Vector2 BossEnemy::calculateCirclingPosition(Vector2 playerPos, float angle, flo
     );
 }
 
-void BossEnemy::executeAttack(float deltaTime, Vector2 playerPos, std::vector<std::unique_ptr<Bullet>>& bullets) {
+void BossEnemy::executeAttack(float deltaTime, Vector2 playerPos, SpawnBuffer& spawns) {
     timeSinceLastAttack += deltaTime;
     
     if (timeSinceLastAttack < attackCooldown) {
@@ -154,13 +141,13 @@ void BossEnemy::executeAttack(float deltaTime, Vector2 playerPos, std::vector<st
     
     switch (currentAttackType) {
         case BossAttackType::SINGLE_SHOT:
-            singleShotAttack(playerPos, bullets);
+            singleShotAttack(playerPos, spawns);
             break;
         case BossAttackType::SPREAD_SHOT:
-            spreadShotAttack(playerPos, bullets);
+            spreadShotAttack(playerPos, spawns);
             break;
         case BossAttackType::CIRCULAR_SHOT:
-            circularShotAttack(playerPos, bullets);
+            circularShotAttack(playerPos, spawns);
             break;
     }
     
@@ -168,16 +155,16 @@ void BossEnemy::executeAttack(float deltaTime, Vector2 playerPos, std::vector<st
     attackCounter++;
 }
 
-void BossEnemy::singleShotAttack(Vector2 playerPos, std::vector<std::unique_ptr<Bullet>>& bullets) {
+void BossEnemy::singleShotAttack(Vector2 playerPos, SpawnBuffer& spawns) {
     Vector2 direction = (playerPos - position).normalized();
-    bullets.push_back(std::make_unique<Bullet>(
+    spawns.spawnBullet(
         position, direction, 
         /*damage*/ 15, /*range*/ 800.0f, /*speed*/ 400.0f, 
         BulletType::BOSS_LARGE, /*enemyOwned*/ true
-    ));
+    );
 }
 
-void BossEnemy::spreadShotAttack(Vector2 playerPos, std::vector<std::unique_ptr<Bullet>>& bullets) {
+void BossEnemy::spreadShotAttack(Vector2 playerPos, SpawnBuffer& spawns) {
     Vector2 baseDirection = (playerPos - position).normalized();
     
     // 5 bullets in spread pattern (angles: -30°, -15°, 0°, 15°, 30°)
@@ -188,90 +175,80 @@ void BossEnemy::spreadShotAttack(Vector2 playerPos, std::vector<std::unique_ptr<
             baseDirection.x * sin(angleOffset) + baseDirection.y * cos(angleOffset)
         );
         
-        bullets.push_back(std::make_unique<Bullet>(
+        spawns.spawnBullet(
             position, direction,
             /*damage*/ 12, /*range*/ 600.0f, /*speed*/ 350.0f,
             BulletType::BOSS_MEDIUM, /*enemyOwned*/ true
-        ));
+        );
     }
 }
 
-void BossEnemy::circularShotAttack(Vector2 playerPos, std::vector<std::unique_ptr<Bullet>>& bullets) {
+void BossEnemy::circularShotAttack(Vector2 playerPos, SpawnBuffer& spawns) {
     // 8 bullets in circle (every 45°)
     for (int i = 0; i < 8; i++) {
         float angle = i * 0.7854f; // 45° in radians
         Vector2 direction(cos(angle), sin(angle));
         
-        bullets.push_back(std::make_unique<Bullet>(
+        spawns.spawnBullet(
             position, direction,
             /*damage*/ 10, /*range*/ 500.0f, /*speed*/ 300.0f,
             BulletType::BOSS_SMALL, /*enemyOwned*/ true
-        ));
+        );
     }
 }
 
-void BossEnemy::renderHealthBar(SDL_Renderer* renderer) {
+void BossEnemy::renderHealthBar(RenderQueue& queue) {
     // Health bar dimensions
     int barWidth = 120;
     int barHeight = 12;
-    int barX = static_cast<int>(position.x - static_cast<float>(barWidth) / 2.0f);
-    int barY = static_cast<int>(position.y - radius - 20);
+    Vector2 renderPos = queue.interpolate(previousPosition, position);
+    int barX = static_cast<int>(renderPos.x - static_cast<float>(barWidth) / 2.0f);
+    int barY = static_cast<int>(renderPos.y - radius - 20);
     
     // Background bar (Yellow)
-    SDL_SetRenderDrawColor(renderer, 255, 255, 0, 255);
     SDL_Rect bgRect = {barX - 2, barY - 2, barWidth + 4, barHeight + 4};
-    SDL_RenderFillRect(renderer, &bgRect);
+    queue.submitRect(RenderLayer::ENEMY_OVERLAY, bgRect, {255, 255, 0, 255}, 0);
     
     // Black bar (missing health)
-    SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255);
     SDL_Rect fullRect = {barX, barY, barWidth, barHeight};
-    SDL_RenderFillRect(renderer, &fullRect);
+    queue.submitRect(RenderLayer::ENEMY_OVERLAY, fullRect, {0, 0, 0, 255}, 1);
     
     // Red bar (current health)
     float healthPercent = static_cast<float>(health) / static_cast<float>(maxHealth);
     int healthWidth = static_cast<int>(barWidth * healthPercent);
-    SDL_SetRenderDrawColor(renderer, 200, 0, 0, 255);
     SDL_Rect healthRect = {barX, barY, healthWidth, barHeight};
-    SDL_RenderFillRect(renderer, &healthRect);
+    queue.submitRect(RenderLayer::ENEMY_OVERLAY, healthRect, {200, 0, 0, 255}, 2);
 }
 
-void BossEnemy::render(SDL_Renderer* renderer) {
+void BossEnemy::render(RenderQueue& queue) {
+    Vector2 renderPos = queue.interpolate(previousPosition, position);
+    
     // Render boss sprite
-    if (bossTexture) {
+    if (bossTexture.texture()) {
         SDL_Rect destRect = {
-            static_cast<int>(position.x - radius),
-            static_cast<int>(position.y - radius),
+            static_cast<int>(renderPos.x - radius),
+            static_cast<int>(renderPos.y - radius),
             static_cast<int>(radius * 2),
             static_cast<int>(radius * 2)
         };
-        SDL_RenderCopy(renderer, bossTexture, nullptr, &destRect);
+        queue.submitSprite(RenderLayer::ENEMIES, bossTexture, destRect);
     } else {
         // Fallback: red circle
-        SDL_SetRenderDrawColor(renderer, 200, 0, 0, 255);
-        int centerX = static_cast<int>(position.x);
-        int centerY = static_cast<int>(position.y);
-        int r = static_cast<int>(radius);
-        
-        for (int y = -r; y <= r; y++) {
-            for (int x = -r; x <= r; x++) {
-                if (x*x + y*y <= r*r) {
-                    SDL_RenderDrawPoint(renderer, centerX + x, centerY + y);
-                }
-            }
-        }
+        queue.submitCircle(RenderLayer::ENEMIES, static_cast<int>(renderPos.x), static_cast<int>(renderPos.y),
+                           static_cast<int>(radius), {200, 0, 0, 255});
     }
     
     // Render health bar
-    renderHealthBar(renderer);
+    renderHealthBar(queue);
 }
 
-void BossEnemy::update(float deltaTime, Vector2 playerPos, std::vector<std::unique_ptr<Bullet>>& bullets) {
+void BossEnemy::update(float deltaTime, Vector2 playerPos, SpawnBuffer& spawns) {
     updateBossState(deltaTime, playerPos);
     updateMovement(deltaTime, playerPos);
     
     // Attacks only in ATTACKING state
     if (currentState == BossState::ATTACKING) {
-        executeAttack(deltaTime, playerPos, bullets);
+        executeAttack(deltaTime, playerPos, spawns);
     }
     
     // Base animation from parent class
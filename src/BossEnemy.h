@@ -19,11 +19,9 @@ public:
     BossEnemy(Vector2 pos, SDL_Renderer* renderer, int currentWave);
     ~BossEnemy() override;
     
-    void update(float deltaTime, Vector2 playerPos, std::vector<std::unique_ptr<Bullet>>& bullets) override;
-    void render(SDL_Renderer* renderer) override;
+    void update(float deltaTime, Vector2 playerPos, SpawnBuffer& spawns) override;
+    void render(RenderQueue& queue) override;
     void takeDamage(int damage) override;
-
-    bool isBoss() const override { return true; }
     
 private:
     // Boss characteristics
@@ -48,16 +46,16 @@ private:
     Vector2 calculateCirclingPosition(Vector2 playerPos, float angle, float radius);
     
     // Attack methods
-    void executeAttack(float deltaTime, Vector2 playerPos, std::vector<std::unique_ptr<Bullet>>& bullets);
-    void singleShotAttack(Vector2 playerPos, std::vector<std::unique_ptr<Bullet>>& bullets);
-    void spreadShotAttack(Vector2 playerPos, std::vector<std::unique_ptr<Bullet>>& bullets);
-    void circularShotAttack(Vector2 playerPos, std::vector<std::unique_ptr<Bullet>>& bullets);
+    void executeAttack(float deltaTime, Vector2 playerPos, SpawnBuffer& spawns);
+    void singleShotAttack(Vector2 playerPos, SpawnBuffer& spawns);
+    void spreadShotAttack(Vector2 playerPos, SpawnBuffer& spawns);
+    void circularShotAttack(Vector2 playerPos, SpawnBuffer& spawns);
     
     // Visualization
-    void renderHealthBar(SDL_Renderer* renderer);
+    void renderHealthBar(RenderQueue& queue);
     void loadBossSprites(SDL_Renderer* renderer);
     
-    SDL_Texture* bossTexture;
+    Sprite bossTexture;
 };
 
 // Factory function
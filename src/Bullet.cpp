@@ -1,101 +0,0 @@
-#include "Bullet.h"
-
-Bullet::Bullet(Vector2 pos, Vector2 dir, int dmg, float range, float speed, BulletType type, bool enemyOwnedFlag) 
-    : position(pos), startPosition(pos), direction(dir.normalized()), 
-      speed(speed), maxRange(range), damage(dmg), alive(true), bulletType(type),
-      velocity(dir.normalized() * speed), gravity(550.0f), enemyOwned(enemyOwnedFlag) {
-    
-    // Set radius based on bullet type
-    switch (type) {
-        case BulletType::BOSS_LARGE:
-            radius = 12;
-            break;
-        case BulletType::BOSS_MEDIUM:
-            radius = 8;
-            break;
-        case BulletType::BOSS_SMALL:
-            radius = 5;
-            break;
-        case BulletType::SNAKE_HEAD:
-            radius = 10;
-            break;
-        case BulletType::SNAKE_BODY1:
-        case BulletType::SNAKE_BODY2:
-        case BulletType::SNAKE_BODY3:
-            radius = 7;
-            break;
-        default:
-            radius = 7;
-            break;
-    }
-}
-
-void Bullet::update(float deltaTime) {
-    if (bulletType == BulletType::ENEMY_LOB) {
-        // simple parabolic motion: integrate velocity with gravity downward
-        velocity.y += gravity * deltaTime;
-        position += velocity * deltaTime;
-    } else {
-        position += direction * speed * deltaTime;
-    }
-    
-    // Check if bullet is out of bounds
-    if (position.x < 0 || position.x > 1920 || position.y < 0 || position.y > 1080) {
-        alive = false;
-    }
-    
-    // Check if bullet has exceeded its range for non-lob; for lob, use bigger cap
-    float distanceTraveled = startPosition.distance(position);
-    float allowedRange = (bulletType == BulletType::ENEMY_LOB) ? maxRange * 1.5f : maxRange;
-    if (distanceTraveled > allowedRange) {
-        alive = false;
-    }
-}
-
-void Bullet::render(SDL_Renderer* renderer) {
-    if (!alive) return;
-    
-    // Color based on bullet type and ownership
-    if (enemyOwned) {
-        switch (bulletType) {
-            case BulletType::BOSS_LARGE:
-                SDL_SetRenderDrawColor(renderer, 200, 0, 200, 255); // Purple for large boss bullets
-                break;
-            case BulletType::BOSS_MEDIUM:
-                SDL_SetRenderDrawColor(renderer, 255, 100, 0, 255); // Orange for medium boss bullets
-                break;
-            case BulletType::BOSS_SMALL:
-                SDL_SetRenderDrawColor(renderer, 0, 200, 255, 255); // Cyan for small boss bullets
-                break;
-            case BulletType::SNAKE_HEAD:
-                SDL_SetRenderDrawColor(renderer, 255, 0, 0, 255); // Red for snake head bullets
-                break;
-            case BulletType::SNAKE_BODY1:
-                SDL_SetRenderDrawColor(renderer, 0, 255, 0, 255); // Green for snake body 1 bullets
-                break;
-            case BulletType::SNAKE_BODY2:
-                SDL_SetRenderDrawColor(renderer, 0, 0, 255, 255); // Blue for snake body 2 bullets
-                break;
-            case BulletType::SNAKE_BODY3:
-                SDL_SetRenderDrawColor(renderer, 255, 255, 0, 255); // Yellow for snake body 3 bullets
-                break;
-            default:
-                SDL_SetRenderDrawColor(renderer, 255, 50, 50, 255); // Red for regular enemy bullets
-                break;
-        }
-    } else {
-        SDL_SetRenderDrawColor(renderer, 255, 255, 0, 255); // Yellow for player bullets
-    }
-    
-    int centerX = (int)position.x;
-    int centerY = (int)position.y;
-    int r = (int)radius;
-    
-    for (int x = -r; x <= r; x++) {
-        for (int y = -r; y <= r; y++) {
-            if (x*x + y*y <= r*r) {
-                SDL_RenderDrawPoint(renderer, centerX + x, centerY + y);
-            }
-        }
-    }
-}
\ No newline at end of file
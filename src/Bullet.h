@@ -1,47 +0,0 @@
-#pragma once
-#include <SDL2/SDL.h>
-#include "Vector2.h"
-
-enum class BulletType {
-    PISTOL,
-    SMG,
-    ENEMY_LOB,
-    BOSS_LARGE,    // Large boss bullet
-    BOSS_MEDIUM,   // Medium boss bullet
-    BOSS_SMALL,    // Small boss bullet
-    SNAKE_HEAD,    // Snake boss head bullet (red)
-    SNAKE_BODY1,   // Snake boss body segment 1 bullet (green)
-    SNAKE_BODY2,   // Snake boss body segment 2 bullet (blue)
-    SNAKE_BODY3    // Snake boss body segment 3 bullet (yellow)
-};
-
-class Bullet {
-public:
-    Bullet(Vector2 pos, Vector2 dir, int damage = 10, float range = 200.0f, float speed = 400.0f, BulletType type = BulletType::PISTOL, bool enemyOwned = false);
-    
-    void update(float deltaTime);
-    void render(SDL_Renderer* renderer);
-    
-    Vector2 getPosition() const { return position; }
-    float getRadius() const { return radius; }
-    int getDamage() const { return damage; }
-    bool isAlive() const { return alive; }
-    void destroy() { alive = false; }
-    bool isEnemyOwned() const { return enemyOwned; }
-    
-private:
-    Vector2 position;
-    Vector2 startPosition;
-    Vector2 direction;
-    float speed;
-    float radius;
-    float maxRange;
-    int damage;
-    bool alive;
-    BulletType bulletType;
-    
-    // For enemy lob projectiles
-    Vector2 velocity; // used when bulletType == ENEMY_LOB
-    float gravity;    // positive value pulls "down" on screen
-    bool enemyOwned;
-};
\ No newline at end of file
@@ -0,0 +1,157 @@
+#include "BulletPool.h"
+#include <algorithm>
+#include <iostream>
+
+BulletPool::BulletPool()
+    : count(0),
+      positionX(CAPACITY), positionY(CAPACITY), previousX(CAPACITY), previousY(CAPACITY),
+      velocityX(CAPACITY), velocityY(CAPACITY), startX(CAPACITY), startY(CAPACITY),
+      radius(CAPACITY), maxRangeSq(CAPACITY), damage(CAPACITY), type(CAPACITY),
+      alive(CAPACITY), enemyOwned(CAPACITY) {
+}
+
+float BulletPool::getRadiusForType(BulletType bulletType) {
+    switch (bulletType) {
+        case BulletType::BOSS_LARGE:
+            return 12;
+        case BulletType::BOSS_MEDIUM:
+            return 8;
+        case BulletType::BOSS_SMALL:
+            return 5;
+        case BulletType::SNAKE_HEAD:
+            return 10;
+        case BulletType::SNAKE_BODY1:
+        case BulletType::SNAKE_BODY2:
+        case BulletType::SNAKE_BODY3:
+            return 7;
+        default:
+            return 7;
+    }
+}
+
+int BulletPool::spawn(Vector2 pos, Vector2 dir, int dmg, float range, float speed, BulletType bulletType, bool enemyOwnedFlag) {
+    if (count >= CAPACITY) {
+        static bool warned = false;
+        if (!warned) {
+            std::cout << "Bullet pool full (" << CAPACITY << "), dropping new bullets" << std::endl;
+            warned = true;
+        }
+        return -1;
+    }
+
+    int index = count++;
+    Vector2 velocity = dir.normalized() * speed;
+    // Lobs arc, so they get extra range before being culled
+    float allowedRange = (bulletType == BulletType::ENEMY_LOB) ? range * 1.5f : range;
+
+    positionX[index] = pos.x;
+    positionY[index] = pos.y;
+    previousX[index] = pos.x;
+    previousY[index] = pos.y;
+    velocityX[index] = velocity.x;
+    velocityY[index] = velocity.y;
+    startX[index] = pos.x;
+    startY[index] = pos.y;
+    radius[index] = getRadiusForType(bulletType);
+    maxRangeSq[index] = allowedRange * allowedRange;
+    damage[index] = dmg;
+    type[index] = bulletType;
+    alive[index] = 1;
+    enemyOwned[index] = enemyOwnedFlag ? 1 : 0;
+    return index;
+}
+
+void BulletPool::beginTick() {
+    std::copy(positionX.begin(), positionX.begin() + count, previousX.begin());
+    std::copy(positionY.begin(), positionY.begin() + count, previousY.begin());
+}
+
+void BulletPool::update(float deltaTime, int begin, int end) {
+    // Gravity first, only lobs have it
+    for (int i = begin; i < end; i++) {
+        if (type[i] == BulletType::ENEMY_LOB) {
+            velocityY[i] += LOB_GRAVITY * deltaTime;
+        }
+    }
+
+    for (int i = begin; i < end; i++) {
+        positionX[i] += velocityX[i] * deltaTime;
+        positionY[i] += velocityY[i] * deltaTime;
+    }
+}
+
+void BulletPool::expire() {
+    for (int i = 0; i < count; i++) {
+        float x = positionX[i];
+        float y = positionY[i];
+        float dx = x - startX[i];
+        float dy = y - startY[i];
+        bool outOfBounds = x < 0 || x > 1920 || y < 0 || y > 1080;
+        bool outOfRange = dx * dx + dy * dy > maxRangeSq[i];
+        if (outOfBounds || outOfRange) {
+            alive[i] = 0;
+        }
+    }
+}
+
+void BulletPool::moveSlot(int from, int to) {
+    positionX[to] = positionX[from];
+    positionY[to] = positionY[from];
+    previousX[to] = previousX[from];
+    previousY[to] = previousY[from];
+    velocityX[to] = velocityX[from];
+    velocityY[to] = velocityY[from];
+    startX[to] = startX[from];
+    startY[to] = startY[from];
+    radius[to] = radius[from];
+    maxRangeSq[to] = maxRangeSq[from];
+    damage[to] = damage[from];
+    type[to] = type[from];
+    alive[to] = alive[from];
+    enemyOwned[to] = enemyOwned[from];
+}
+
+void BulletPool::compact() {
+    int i = 0;
+    while (i < count) {
+        if (alive[i]) {
+            i++;
+            continue;
+        }
+        // Fill the hole with the last bullet; re-check slot i since it may be dead too
+        count--;
+        if (i != count) {
+            moveSlot(count, i);
+        }
+    }
+}
+
+void BulletPool::clear() {
+    count = 0;
+}
+
+SDL_Color BulletPool::getColor(int index) const {
+    // Color based on bullet type and ownership
+    if (!enemyOwned[index]) {
+        return {255, 255, 0, 255}; // Yellow for player bullets
+    }
+    
+    switch (type[index]) {
+        case BulletType::BOSS_LARGE:
+            return {200, 0, 200, 255}; // Purple for large boss bullets
+        case BulletType::BOSS_MEDIUM:
+            return {255, 100, 0, 255}; // Orange for medium boss bullets
+        case BulletType::BOSS_SMALL:
+            return {0, 200, 255, 255}; // Cyan for small boss bullets
+        case BulletType::SNAKE_HEAD:
+            return {255, 0, 0, 255}; // Red for snake head bullets
+        case BulletType::SNAKE_BODY1:
+            return {0, 255, 0, 255}; // Green for snake body 1 bullets
+        case BulletType::SNAKE_BODY2:
+            return {0, 0, 255, 255}; // Blue for snake body 2 bullets
+        case BulletType::SNAKE_BODY3:
+            return {255, 255, 0, 255}; // Yellow for snake body 3 bullets
+        default:
+            return {255, 50, 50, 255}; // Red for regular enemy bullets
+    }
+}
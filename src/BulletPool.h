@@ -0,0 +1,86 @@
+#pragma once
+#include <SDL2/SDL.h>
+#include <vector>
+#include "Vector2.h"
+
+enum class BulletType {
+    PISTOL,
+    SMG,
+    ENEMY_LOB,
+    BOSS_LARGE,    // Large boss bullet
+    BOSS_MEDIUM,   // Medium boss bullet
+    BOSS_SMALL,    // Small boss bullet
+    SNAKE_HEAD,    // Snake boss head bullet (red)
+    SNAKE_BODY1,   // Snake boss body segment 1 bullet (green)
+    SNAKE_BODY2,   // Snake boss body segment 2 bullet (blue)
+    SNAKE_BODY3    // Snake boss body segment 3 bullet (yellow)
+};
+
+// Every live bullet, stored as a structure of arrays with a fixed capacity.
+// Slots [0, size()) are packed; all arrays are allocated once up front so
+// spawning never touches the heap.
+//
+// Indices returned by spawn() and used by the accessors stay valid until the
+// next compact(), which swap-removes dead bullets at the end of a tick.
+class BulletPool {
+public:
+    static const int CAPACITY = 8192;
+
+    BulletPool();
+
+    // Returns the new bullet's index, or -1 when the pool is full
+    int spawn(Vector2 pos, Vector2 dir, int damage = 10, float range = 200.0f, float speed = 400.0f,
+              BulletType type = BulletType::PISTOL, bool enemyOwned = false);
+
+    // Remembers positions at the start of a tick for render interpolation
+    void beginTick();
+    // Moves every bullet; getPreviousPosition() -> getPosition() is the segment
+    // collision sweeps for this tick
+    void update(float deltaTime) { update(deltaTime, 0, count); }
+    // Same for slots [begin, end) only; disjoint ranges can run on different threads
+    void update(float deltaTime, int begin, int end);
+    // Kills bullets out of bounds or past their range. Runs after collisions
+    // so a bullet that leaves the arena mid-tick can still hit on the way out.
+    void expire();
+    // Swap-removes dead bullets; invalidates indices
+    void compact();
+    void clear();
+
+    int size() const { return count; }
+    bool empty() const { return count == 0; }
+
+    Vector2 getPosition(int index) const { return Vector2(positionX[index], positionY[index]); }
+    Vector2 getPreviousPosition(int index) const { return Vector2(previousX[index], previousY[index]); }
+    float getRadius(int index) const { return radius[index]; }
+    int getDamage(int index) const { return damage[index]; }
+    BulletType getType(int index) const { return type[index]; }
+    bool isAlive(int index) const { return alive[index] != 0; }
+    bool isEnemyOwned(int index) const { return enemyOwned[index] != 0; }
+    void destroy(int index) { alive[index] = 0; }
+    SDL_Color getColor(int index) const;
+
+    static float getRadiusForType(BulletType bulletType);
+
+private:
+    void moveSlot(int from, int to);
+
+    int count;
+
+    std::vector<float> positionX;
+    std::vector<float> positionY;
+    std::vector<float> previousX;
+    std::vector<float> previousY;
+    std::vector<float> velocityX;
+    std::vector<float> velocityY;
+    std::vector<float> startX;
+    std::vector<float> startY;
+    std::vector<float> radius;
+    std::vector<float> maxRangeSq; // Squared, so the range check needs no sqrt
+    std::vector<int> damage;
+    std::vector<BulletType> type;
+    std::vector<Uint8> alive;
+    std::vector<Uint8> enemyOwned;
+
+    // Lob projectiles fall "down" the screen
+    static constexpr float LOB_GRAVITY = 550.0f;
+};
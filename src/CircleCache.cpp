@@ -0,0 +1,132 @@
+#include "CircleCache.h"
+#include <cmath>
+#include <iostream>
+
+std::unordered_map<uint64_t, SDL_Texture*>& CircleCache::textures() {
+    static std::unordered_map<uint64_t, SDL_Texture*> cache;
+    return cache;
+}
+
+uint64_t CircleCache::makeKey(CircleShape shape, int radius, SDL_Color color, int param) {
+    // shape:2 | radius:14 | param:16 | rgba:32
+    uint64_t key = static_cast<uint64_t>(shape) & 0x3;
+    key = (key << 14) | (static_cast<uint64_t>(radius) & 0x3FFF);
+    key = (key << 16) | (static_cast<uint64_t>(param) & 0xFFFF);
+    key = (key << 32) | (static_cast<uint64_t>(color.r) << 24) | (static_cast<uint64_t>(color.g) << 16) |
+          (static_cast<uint64_t>(color.b) << 8) | static_cast<uint64_t>(color.a);
+    return key;
+}
+
+int CircleCache::getExtent(CircleShape shape, int radius, int param) {
+    return (shape == CircleShape::FILLED) ? radius + param : radius;
+}
+
+SDL_Texture* CircleCache::getTexture(SDL_Renderer* renderer, CircleShape shape, int radius,
+                                     SDL_Color color, int param) {
+    if (radius < 0) radius = 0;
+    if (param < 0) param = 0;
+
+    uint64_t key = makeKey(shape, radius, color, param);
+    auto& cache = textures();
+    auto it = cache.find(key);
+    if (it != cache.end()) {
+        return it->second;
+    }
+
+    SDL_Texture* texture = rasterize(renderer, shape, radius, color, param);
+    cache[key] = texture; // Cache failures too so we don't retry every frame
+    return texture;
+}
+
+SDL_Texture* CircleCache::rasterize(SDL_Renderer* renderer, CircleShape shape, int radius,
+                                    SDL_Color color, int param) {
+    int extent = getExtent(shape, radius, param);
+    int size = extent * 2 + 1;
+
+    SDL_Surface* surface = SDL_CreateRGBSurfaceWithFormat(0, size, size, 32, SDL_PIXELFORMAT_RGBA32);
+    if (!surface) {
+        std::cout << "Unable to create circle surface! SDL Error: " << SDL_GetError() << std::endl;
+        return nullptr;
+    }
+
+    // Start fully transparent, then plot the same pixels the old
+    // SDL_RenderDrawPoint loops used to touch every frame
+    SDL_FillRect(surface, nullptr, SDL_MapRGBA(surface->format, 0, 0, 0, 0));
+    Uint32* pixels = static_cast<Uint32*>(surface->pixels);
+    int pitch = surface->pitch / 4;
+    Uint32 solid = SDL_MapRGBA(surface->format, color.r, color.g, color.b, color.a);
+
+    if (shape == CircleShape::FILLED) {
+        int glow = param;
+        Uint32 halo = SDL_MapRGBA(surface->format, color.r, color.g, color.b,
+                                  static_cast<Uint8>(color.a * 0.3f));
+        for (int y = -extent; y <= extent; y++) {
+            for (int x = -extent; x <= extent; x++) {
+                int distSq = x * x + y * y;
+                Uint32* pixel = &pixels[(y + extent) * pitch + (x + extent)];
+                if (distSq <= radius * radius) {
+                    *pixel = solid;
+                } else if (glow > 0 && std::sqrt(static_cast<float>(distSq)) <= radius + glow) {
+                    *pixel = halo;
+                }
+            }
+        }
+    } else {
+        int dots = param > 0 ? param : 36;
+        for (int i = 0; i < dots; i++) {
+            float rad = (2.0f * static_cast<float>(M_PI) * i) / dots;
+            int x = extent + static_cast<int>(std::cos(rad) * radius);
+            int y = extent + static_cast<int>(std::sin(rad) * radius);
+            if (x >= 0 && x < size && y >= 0 && y < size) {
+                pixels[y * pitch + x] = solid;
+            }
+        }
+    }
+
+    SDL_Texture* texture = SDL_CreateTextureFromSurface(renderer, surface);
+    SDL_FreeSurface(surface);
+
+    if (!texture) {
+        std::cout << "Unable to create circle texture! SDL Error: " << SDL_GetError() << std::endl;
+        return nullptr;
+    }
+
+    SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
+    return texture;
+}
+
+void CircleCache::drawFilled(SDL_Renderer* renderer, int centerX, int centerY, int radius,
+                             SDL_Color color, int glow, Uint8 alpha) {
+    SDL_Texture* texture = getTexture(renderer, CircleShape::FILLED, radius, color, glow);
+    if (!texture) return;
+
+    int extent = getExtent(CircleShape::FILLED, radius, glow);
+    SDL_Rect destRect = {centerX - extent, centerY - extent, extent * 2 + 1, extent * 2 + 1};
+    SDL_SetTextureAlphaMod(texture, alpha);
+    SDL_RenderCopy(renderer, texture, nullptr, &destRect);
+}
+
+void CircleCache::drawRing(SDL_Renderer* renderer, int centerX, int centerY, int radius,
+                           SDL_Color color, int dots, Uint8 alpha) {
+    SDL_Texture* texture = getTexture(renderer, CircleShape::RING, radius, color, dots);
+    if (!texture) return;
+
+    int extent = getExtent(CircleShape::RING, radius, dots);
+    SDL_Rect destRect = {centerX - extent, centerY - extent, extent * 2 + 1, extent * 2 + 1};
+    SDL_SetTextureAlphaMod(texture, alpha);
+    SDL_RenderCopy(renderer, texture, nullptr, &destRect);
+}
+
+void CircleCache::clear() {
+    auto& cache = textures();
+    for (auto& entry : cache) {
+        if (entry.second) {
+            SDL_DestroyTexture(entry.second);
+        }
+    }
+    cache.clear();
+}
+
+int CircleCache::getTextureCount() {
+    return static_cast<int>(textures().size());
+}
@@ -0,0 +1,44 @@
+#pragma once
+#include <SDL2/SDL.h>
+#include <cstdint>
+#include <unordered_map>
+
+enum class CircleShape {
+    FILLED,  // Solid disc, optionally surrounded by a faint glow halo
+    RING     // Dotted outline (evenly spaced points on the circumference)
+};
+
+// Pre-rasterized circle sprites.
+// Every (shape, radius, color, glow/dots) combination is drawn pixel by pixel
+// into a texture exactly once; after that each circle costs one SDL_RenderCopy
+// instead of one SDL_RenderDrawPoint per covered pixel.
+class CircleCache {
+public:
+    // Filled circle centered on (centerX, centerY). A non-zero glow adds a halo
+    // `glow` pixels wide at 30% of the color's alpha. `alpha` is applied as a
+    // texture alpha mod so fading objects don't need their own textures.
+    static void drawFilled(SDL_Renderer* renderer, int centerX, int centerY, int radius,
+                           SDL_Color color, int glow = 0, Uint8 alpha = 255);
+
+    // Dotted ring made of `dots` points spread evenly around the circle
+    static void drawRing(SDL_Renderer* renderer, int centerX, int centerY, int radius,
+                         SDL_Color color, int dots, Uint8 alpha = 255);
+
+    // Returns (creating on first use) the texture for a circle. `param` is the
+    // glow width for FILLED circles and the dot count for RINGs.
+    static SDL_Texture* getTexture(SDL_Renderer* renderer, CircleShape shape, int radius,
+                                   SDL_Color color, int param);
+
+    // Half the texture size: distance from the circle center to the texture edge
+    static int getExtent(CircleShape shape, int radius, int param);
+
+    // Destroys every cached texture. Must run before the renderer is destroyed.
+    static void clear();
+    static int getTextureCount();
+
+private:
+    static uint64_t makeKey(CircleShape shape, int radius, SDL_Color color, int param);
+    static SDL_Texture* rasterize(SDL_Renderer* renderer, CircleShape shape, int radius,
+                                  SDL_Color color, int param);
+    static std::unordered_map<uint64_t, SDL_Texture*>& textures();
+};
@@ -0,0 +1,33 @@
+#pragma once
+#include <cmath>
+
+// Swept circle vs static circle.
+// A circle of the combined radius `radius` moves from (x0, y0) to (x1, y1)
+// during the tick; returns the fraction t in [0, 1] of the move at which it
+// first touches the circle at (centerX, centerY), or -1 when it never does.
+// Already overlapping at the start counts as t = 0.
+inline float sweepCircle(float x0, float y0, float x1, float y1, float radius, float centerX, float centerY) {
+    float mx = x0 - centerX;
+    float my = y0 - centerY;
+    float c = mx * mx + my * my - radius * radius;
+    if (c < 0.0f) {
+        return 0.0f;
+    }
+
+    float dx = x1 - x0;
+    float dy = y1 - y0;
+    float a = dx * dx + dy * dy;
+    float b = mx * dx + my * dy;
+    // Not moving, or moving away from the center
+    if (a <= 0.0f || b >= 0.0f) {
+        return -1.0f;
+    }
+
+    float discriminant = b * b - a * c;
+    if (discriminant < 0.0f) {
+        return -1.0f;
+    }
+
+    float t = (-b - std::sqrt(discriminant)) / a;
+    return t <= 1.0f ? t : -1.0f;
+}
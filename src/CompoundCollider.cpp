@@ -0,0 +1,126 @@
+#include "CompoundCollider.h"
+#include "Collision.h"
+#include <algorithm>
+#include <cmath>
+
+void CompoundCollider::clear() {
+    partX.clear();
+    partY.clear();
+    partRadius.clear();
+    nodes.clear();
+}
+
+void CompoundCollider::add(Vector2 center, float radius) {
+    partX.push_back(center.x);
+    partY.push_back(center.y);
+    partRadius.push_back(radius);
+}
+
+void CompoundCollider::build() {
+    nodes.clear();
+    if (!empty()) {
+        buildNode(0, size());
+    }
+}
+
+int CompoundCollider::buildNode(int first, int count) {
+    int index = static_cast<int>(nodes.size());
+    nodes.push_back(Node{0.0f, 0.0f, 0.0f, 0.0f, first, count, -1, -1});
+
+    if (count > LEAF_SIZE) {
+        // Split the index range in half; children are built before this node's
+        // box is read back, so grab them by index (push_back may reallocate)
+        int half = count / 2;
+        int left = buildNode(first, half);
+        int right = buildNode(first + half, count - half);
+        Node& node = nodes[index];
+        node.left = left;
+        node.right = right;
+        node.minX = std::min(nodes[left].minX, nodes[right].minX);
+        node.minY = std::min(nodes[left].minY, nodes[right].minY);
+        node.maxX = std::max(nodes[left].maxX, nodes[right].maxX);
+        node.maxY = std::max(nodes[left].maxY, nodes[right].maxY);
+        return index;
+    }
+
+    Node& node = nodes[index];
+    node.minX = partX[first] - partRadius[first];
+    node.minY = partY[first] - partRadius[first];
+    node.maxX = partX[first] + partRadius[first];
+    node.maxY = partY[first] + partRadius[first];
+    for (int part = first + 1; part < first + count; part++) {
+        node.minX = std::min(node.minX, partX[part] - partRadius[part]);
+        node.minY = std::min(node.minY, partY[part] - partRadius[part]);
+        node.maxX = std::max(node.maxX, partX[part] + partRadius[part]);
+        node.maxY = std::max(node.maxY, partY[part] + partRadius[part]);
+    }
+    return index;
+}
+
+template <typename Fn>
+void CompoundCollider::forEachCandidate(float minX, float minY, float maxX, float maxY, Fn&& fn) const {
+    if (nodes.empty()) return;
+
+    // Halving index ranges keeps the depth at log2(parts / LEAF_SIZE), so a
+    // small fixed stack covers any realistic part count
+    int stack[64];
+    int top = 0;
+    stack[top++] = 0;
+    while (top > 0) {
+        const Node& node = nodes[stack[--top]];
+        if (node.maxX < minX || node.minX > maxX || node.maxY < minY || node.minY > maxY) {
+            continue;
+        }
+        if (node.left < 0) {
+            for (int part = node.first; part < node.first + node.count; part++) {
+                fn(part);
+            }
+        } else {
+            stack[top++] = node.right;
+            stack[top++] = node.left;
+        }
+    }
+}
+
+Vector2 CompoundCollider::getBoundsCenter() const {
+    if (nodes.empty()) return Vector2(0.0f, 0.0f);
+    const Node& root = nodes[0];
+    return Vector2((root.minX + root.maxX) * 0.5f, (root.minY + root.maxY) * 0.5f);
+}
+
+float CompoundCollider::getBoundsRadius() const {
+    if (nodes.empty()) return 0.0f;
+    const Node& root = nodes[0];
+    float halfWidth = (root.maxX - root.minX) * 0.5f;
+    float halfHeight = (root.maxY - root.minY) * 0.5f;
+    return std::sqrt(halfWidth * halfWidth + halfHeight * halfHeight);
+}
+
+int CompoundCollider::overlapFirst(Vector2 center, float radius) const {
+    int best = -1;
+    forEachCandidate(center.x - radius, center.y - radius, center.x + radius, center.y + radius, [&](int part) {
+        if (best >= 0 && part > best) return;
+        float dx = partX[part] - center.x;
+        float dy = partY[part] - center.y;
+        float range = radius + partRadius[part];
+        if (dx * dx + dy * dy < range * range) {
+            best = part;
+        }
+    });
+    return best;
+}
+
+int CompoundCollider::sweep(Vector2 from, Vector2 to, float radius, float& hitTime) const {
+    int best = -1;
+    float bestTime = 2.0f;
+    forEachCandidate(std::min(from.x, to.x) - radius, std::min(from.y, to.y) - radius,
+                     std::max(from.x, to.x) + radius, std::max(from.y, to.y) + radius, [&](int part) {
+        float t = sweepCircle(from.x, from.y, to.x, to.y, radius + partRadius[part], partX[part], partY[part]);
+        if (t >= 0.0f && (t < bestTime || (t == bestTime && part < best))) {
+            best = part;
+            bestTime = t;
+        }
+    });
+    hitTime = bestTime;
+    return best;
+}
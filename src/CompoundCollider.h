@@ -0,0 +1,57 @@
+#pragma once
+#include <vector>
+#include "Vector2.h"
+
+// Collision shape made of several circles, e.g. a snake's head and body
+// segments. Parts are grouped into a small bounding-volume hierarchy of boxes
+// over consecutive part indices (neighbouring segments are also neighbours in
+// space), so a query first rejects against the whole shape's box and then only
+// tests the parts in leaves it actually reaches.
+//
+// Owners rebuild it whenever their parts move: clear(), add() every part,
+// build(). Storage is reused, so this doesn't allocate once it has grown.
+class CompoundCollider {
+public:
+    void clear();
+    void add(Vector2 center, float radius);
+    // Fits the hierarchy to the current parts; call after the last add()
+    void build();
+
+    int size() const { return static_cast<int>(partX.size()); }
+    bool empty() const { return partX.empty(); }
+    Vector2 getPartCenter(int part) const { return Vector2(partX[part], partY[part]); }
+    float getPartRadius(int part) const { return partRadius[part]; }
+
+    // Circle enclosing every part, for broadphase structures
+    Vector2 getBoundsCenter() const;
+    float getBoundsRadius() const;
+
+    // Lowest-index part overlapping the circle, or -1
+    int overlapFirst(Vector2 center, float radius) const;
+    bool overlaps(Vector2 center, float radius) const { return overlapFirst(center, radius) >= 0; }
+
+    // Earliest part touched by a circle moving from `from` to `to`, or -1.
+    // hitTime receives the fraction of the move in [0, 1].
+    int sweep(Vector2 from, Vector2 to, float radius, float& hitTime) const;
+
+private:
+    struct Node {
+        float minX, minY, maxX, maxY;
+        int first; // Parts [first, first + count)
+        int count;
+        int left;  // Child nodes, -1 for leaves
+        int right;
+    };
+
+    int buildNode(int first, int count);
+    // Calls fn(part) for every part in a leaf whose box touches the query box
+    template <typename Fn>
+    void forEachCandidate(float minX, float minY, float maxX, float maxY, Fn&& fn) const;
+
+    std::vector<float> partX;
+    std::vector<float> partY;
+    std::vector<float> partRadius;
+    std::vector<Node> nodes; // nodes[0] is the root
+
+    static const int LEAF_SIZE = 4;
+};
@@ -0,0 +1,31 @@
+#include "ContactList.h"
+#include <algorithm>
+
+void ContactList::setThreadCount(int count) {
+    lists.resize(std::max(1, count));
+    for (auto& list : lists) {
+        list.reserve(256);
+    }
+}
+
+const std::vector<Contact>& ContactList::sorted() {
+    merged.clear();
+    for (auto& list : lists) {
+        merged.insert(merged.end(), list.begin(), list.end());
+        list.clear();
+    }
+
+    std::sort(merged.begin(), merged.end(), [](const Contact& a, const Contact& b) {
+        if (a.kind != b.kind) return a.kind < b.kind;
+        if (a.source != b.source) return a.source < b.source;
+        return a.enemyId < b.enemyId;
+    });
+    return merged;
+}
+
+void ContactList::clear() {
+    for (auto& list : lists) {
+        list.clear();
+    }
+    merged.clear();
+}
@@ -0,0 +1,36 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+
+enum class ContactKind : uint8_t {
+    BULLET, // Bullet slot `source` reached `target` (-1: the player)
+    BODY,   // Enemy `target` touches the player
+    MELEE   // Player weapon `source` reached enemy `target`
+};
+
+// One overlap found by a collision query, applied later by a serial resolve
+struct Contact {
+    ContactKind kind;
+    int source;       // Bullet slot or weapon index, -1 if none
+    uint32_t enemyId; // EnemyStore id of the enemy involved, 0 for none
+    int target;       // Index into Game::gridEnemies, -1 for the player
+};
+
+// Contacts recorded by the read-only query phase, one list per job thread so
+// queries can run in parallel without locks. sorted() merges them in a fixed
+// order (kind, source, enemy id): the resolve applies damage, kills and
+// drops the same way whatever the thread count or scheduling was.
+class ContactList {
+public:
+    // One list per thread index (JobSystem::getThreadCount())
+    void setThreadCount(int count);
+    std::vector<Contact>& forThread(int index) { return lists[index]; }
+
+    // Merges and clears the per-thread lists. Valid until the next call.
+    const std::vector<Contact>& sorted();
+    void clear();
+
+private:
+    std::vector<std::vector<Contact>> lists;
+    std::vector<Contact> merged; // Reused across ticks
+};
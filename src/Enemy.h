@@ -1,27 +1,37 @@
 #pragma once
 #include <SDL2/SDL.h>
-#include <SDL2/SDL_image.h>
 #include <vector>
 #include <memory>
 #include "Vector2.h"
+#include "SpriteAtlas.h"
+#include "RenderQueue.h"
+#include "CompoundCollider.h"
 
 enum class EnemyState {
     IDLE,
     HIT
 };
 
-class Bullet;
+class SpawnBuffer;
 
+// Polymorphic base for bosses. Regular enemies (chasers and shooters) live
+// in EnemyStore's dense per-archetype arrays; only bosses, which have their own
+// state machines and a handful of instances, keep virtual dispatch.
 class Enemy {
 public:
-    Enemy(Vector2 pos, SDL_Renderer* renderer);
+    explicit Enemy(Vector2 pos);
     virtual ~Enemy();
     
-    virtual void update(float deltaTime, Vector2 playerPos, std::vector<std::unique_ptr<Bullet>>& bullets);
-    virtual void render(SDL_Renderer* renderer);
+    // Remembers positions at the start of a tick for render interpolation
+    virtual void beginTick() { previousPosition = position; }
+    virtual void update(float deltaTime, Vector2 playerPos, SpawnBuffer& spawns) = 0;
+    virtual void render(RenderQueue& queue) = 0;
     
     Vector2 getPosition() const { return position; }
     float getRadius() const { return radius; }
+    // Bosses made of several circles return their shape here; null means the
+    // single circle at getPosition() with getRadius()
+    virtual const CompoundCollider* getCollider() const { return nullptr; }
     bool isAlive() const { return alive; }
     void destroy() { alive = false; }
     void hit() { 
@@ -40,15 +50,22 @@ public:
     
     int getDamage() const { return damage; }
     int getHealth() const { return health; }
-
-    virtual bool isBoss() const { return false; }
     
-private:
-    void loadSprites(SDL_Renderer* renderer);
-    SDL_Texture* loadTexture(const char* path, SDL_Renderer* renderer);
+    // Touching a boss hurts the player at most once per CONTACT_COOLDOWN
+    // instead of destroying it like a regular enemy
+    static constexpr float CONTACT_COOLDOWN = 0.5f;
+    void tickContactCooldown(float deltaTime) {
+        if (contactCooldown > 0.0f) contactCooldown -= deltaTime;
+    }
+    bool tryContact() {
+        if (contactCooldown > 0.0f) return false;
+        contactCooldown = CONTACT_COOLDOWN;
+        return true;
+    }
     
 protected:
     Vector2 position;
+    Vector2 previousPosition;
     Vector2 velocity;
     float radius;
     float speed;
@@ -56,16 +73,9 @@ protected:
     int damage;
     bool alive;
     
-    // Animation and sprites
+    // Hit flash
     EnemyState state;
     float animationTimer;
     float hitTimer;
-    int currentFrame;
-    
-    SDL_Texture* idleFrame1;
-    SDL_Texture* idleFrame2;
-    SDL_Texture* hitFrame;
-    
-    int spriteWidth;
-    int spriteHeight;
-};
\ No newline at end of file
+    float contactCooldown = 0.0f;
+};
@@ -0,0 +1,462 @@
+#include "EnemyStore.h"
+#include "SpawnQueue.h"
+#include "Collision.h"
+#include "Steering.h"
+#include "JobSystem.h"
+#include <cmath>
+
+EnemyStore::EnemyStore() : nextId(1) {
+    // Large waves reach the thousands; avoid regrowing the arrays mid-wave
+    chasers.reserve(1024);
+    shooters.body.reserve(512);
+}
+
+void EnemyStore::loadSprites(SDL_Renderer* renderer) {
+    chaserIdle1 = SpriteAtlas::get(renderer, "monsters/landmonster/Transparent PNG/idle/frame-1.png");
+    chaserIdle2 = SpriteAtlas::get(renderer, "monsters/landmonster/Transparent PNG/idle/frame-2.png");
+    chaserHit = SpriteAtlas::get(renderer, "monsters/landmonster/Transparent PNG/got hit/frame.png");
+    slimeSprite = SpriteAtlas::get(renderer, "assets/enemies/slime.png");
+    pebblinSprite = SpriteAtlas::get(renderer, "assets/enemies/pebblin.png");
+}
+
+void EnemyStore::unloadSprites() {
+    chaserIdle1 = Sprite();
+    chaserIdle2 = Sprite();
+    chaserHit = Sprite();
+    slimeSprite = Sprite();
+    pebblinSprite = Sprite();
+}
+
+// --- Groups ---
+
+int EnemyStore::EnemyGroup::add(uint32_t enemyId, Vector2 pos, float moveSpeed, float bodyRadius,
+                                int hp, int contactDamage, float idleFramePeriod) {
+    id.push_back(enemyId);
+    positionX.push_back(pos.x);
+    positionY.push_back(pos.y);
+    previousX.push_back(pos.x);
+    previousY.push_back(pos.y);
+    velocityX.push_back(0.0f);
+    velocityY.push_back(0.0f);
+    speed.push_back(moveSpeed);
+    radius.push_back(bodyRadius);
+    health.push_back(hp);
+    damage.push_back(contactDamage);
+    animationTimer.push_back(0.0f);
+    hitTimer.push_back(0.0f);
+    framePeriod.push_back(idleFramePeriod);
+    hit.push_back(0);
+    frame.push_back(0);
+    alive.push_back(1);
+    return size() - 1;
+}
+
+template <typename T>
+static void swapRemoveAt(std::vector<T>& values, int index) {
+    values[index] = values.back();
+    values.pop_back();
+}
+
+void EnemyStore::EnemyGroup::swapRemove(int index) {
+    swapRemoveAt(id, index);
+    swapRemoveAt(positionX, index);
+    swapRemoveAt(positionY, index);
+    swapRemoveAt(previousX, index);
+    swapRemoveAt(previousY, index);
+    swapRemoveAt(velocityX, index);
+    swapRemoveAt(velocityY, index);
+    swapRemoveAt(speed, index);
+    swapRemoveAt(radius, index);
+    swapRemoveAt(health, index);
+    swapRemoveAt(damage, index);
+    swapRemoveAt(animationTimer, index);
+    swapRemoveAt(hitTimer, index);
+    swapRemoveAt(framePeriod, index);
+    swapRemoveAt(hit, index);
+    swapRemoveAt(frame, index);
+    swapRemoveAt(alive, index);
+}
+
+void EnemyStore::EnemyGroup::clear() {
+    id.clear();
+    positionX.clear();
+    positionY.clear();
+    previousX.clear();
+    previousY.clear();
+    velocityX.clear();
+    velocityY.clear();
+    speed.clear();
+    radius.clear();
+    health.clear();
+    damage.clear();
+    animationTimer.clear();
+    hitTimer.clear();
+    framePeriod.clear();
+    hit.clear();
+    frame.clear();
+    alive.clear();
+}
+
+void EnemyStore::EnemyGroup::reserve(int capacity) {
+    id.reserve(capacity);
+    positionX.reserve(capacity);
+    positionY.reserve(capacity);
+    previousX.reserve(capacity);
+    previousY.reserve(capacity);
+    velocityX.reserve(capacity);
+    velocityY.reserve(capacity);
+    speed.reserve(capacity);
+    radius.reserve(capacity);
+    health.reserve(capacity);
+    damage.reserve(capacity);
+    animationTimer.reserve(capacity);
+    hitTimer.reserve(capacity);
+    framePeriod.reserve(capacity);
+    hit.reserve(capacity);
+    frame.reserve(capacity);
+    alive.reserve(capacity);
+}
+
+int EnemyStore::ShooterGroup::add(uint32_t enemyId, ShooterKind shooterKind, Vector2 pos) {
+    int index;
+    if (shooterKind == ShooterKind::PEBBLIN) {
+        // Heavy, tanky stats - slower but tougher than slimes
+        index = body.add(enemyId, pos, 35.0f, 30.0f, 40, 12, 0.7f);
+        fireCooldown.push_back(3.5f);
+    } else {
+        index = body.add(enemyId, pos, 60.0f, 26.0f, 10, 8, 0.5f);
+        fireCooldown.push_back(2.0f);
+    }
+    kind.push_back(shooterKind);
+    timeSinceLastShot.push_back(0.0f);
+    return index;
+}
+
+void EnemyStore::ShooterGroup::swapRemove(int index) {
+    body.swapRemove(index);
+    swapRemoveAt(kind, index);
+    swapRemoveAt(fireCooldown, index);
+    swapRemoveAt(timeSinceLastShot, index);
+}
+
+void EnemyStore::ShooterGroup::clear() {
+    body.clear();
+    kind.clear();
+    fireCooldown.clear();
+    timeSinceLastShot.clear();
+}
+
+// --- Spawning ---
+
+uint32_t EnemyStore::spawnChaser(Vector2 pos) {
+    uint32_t id = nextId++;
+    chasers.add(id, pos, 80.0f, 30.0f, 10, 10, 0.5f);
+    return id;
+}
+
+uint32_t EnemyStore::spawnShooter(ShooterKind kind, Vector2 pos) {
+    uint32_t id = nextId++;
+    shooters.add(id, kind, pos);
+    return id;
+}
+
+uint32_t EnemyStore::addBoss(std::unique_ptr<Enemy> boss) {
+    uint32_t id = nextId++;
+    bosses.push_back(std::move(boss));
+    bossIds.push_back(id);
+    return id;
+}
+
+// --- Simulation ---
+
+void EnemyStore::beginTick() {
+    chasers.previousX = chasers.positionX;
+    chasers.previousY = chasers.positionY;
+    shooters.body.previousX = shooters.body.positionX;
+    shooters.body.previousY = shooters.body.positionY;
+    for (auto& boss : bosses) {
+        boss->beginTick();
+    }
+}
+
+void EnemyStore::moveTowards(EnemyGroup& group, int begin, int end, float deltaTime, Vector2 playerPos) {
+    // Straight-line homing for the whole range in one dispatched SIMD kernel
+    Steering::chase(group.positionX.data() + begin, group.positionY.data() + begin, group.velocityX.data() + begin,
+                    group.velocityY.data() + begin, group.speed.data() + begin, end - begin, playerPos, deltaTime);
+}
+
+void EnemyStore::animate(EnemyGroup& group, int begin, int end, float deltaTime) {
+    for (int i = begin; i < end; i++) {
+        group.animationTimer[i] += deltaTime;
+
+        // Hit flash, then back to idle
+        if (group.hit[i]) {
+            group.hitTimer[i] += deltaTime;
+            if (group.hitTimer[i] > HIT_FLASH_SECONDS) {
+                group.hit[i] = 0;
+                group.hitTimer[i] = 0.0f;
+            }
+        }
+
+        // Idle animation alternates between two frames
+        if (!group.hit[i] && group.animationTimer[i] > group.framePeriod[i]) {
+            group.frame[i] ^= 1;
+            group.animationTimer[i] = 0.0f;
+        }
+    }
+}
+
+void EnemyStore::fireShooters(int begin, int end, float deltaTime, Vector2 playerPos, SpawnBuffer& spawns) {
+    EnemyGroup& body = shooters.body;
+    for (int i = begin; i < end; i++) {
+        shooters.timeSinceLastShot[i] += deltaTime;
+        if (shooters.timeSinceLastShot[i] < shooters.fireCooldown[i]) continue;
+        shooters.timeSinceLastShot[i] = 0.0f;
+
+        Vector2 position(body.positionX[i], body.positionY[i]);
+        Vector2 toPlayer = playerPos - position;
+        if (toPlayer.lengthSquared() < 1.0f) continue;
+        Vector2 dir = toPlayer.normalized();
+        spawns.beginSource(body.id[i]);
+
+        if (shooters.kind[i] == ShooterKind::SLIME) {
+            // Shoot straight at the player with normal bullet physics
+            spawns.spawnBullet(position, dir, /*damage*/ 10, /*range*/ 600.0f, /*speed*/ 320.0f, BulletType::PISTOL, /*enemyOwned*/ true);
+            continue;
+        }
+
+        // Three-shot rock spread - center shot + two angled shots (~17 degrees)
+        float spreadAngle = 0.3f;
+        Vector2 leftDir(dir.x * std::cos(-spreadAngle) - dir.y * std::sin(-spreadAngle),
+                        dir.x * std::sin(-spreadAngle) + dir.y * std::cos(-spreadAngle));
+        Vector2 rightDir(dir.x * std::cos(spreadAngle) - dir.y * std::sin(spreadAngle),
+                         dir.x * std::sin(spreadAngle) + dir.y * std::cos(spreadAngle));
+        spawns.spawnBullet(position, dir, /*damage*/ 8, /*range*/ 500.0f, /*speed*/ 280.0f, BulletType::PISTOL, /*enemyOwned*/ true);
+        spawns.spawnBullet(position, leftDir, /*damage*/ 8, /*range*/ 500.0f, /*speed*/ 280.0f, BulletType::PISTOL, /*enemyOwned*/ true);
+        spawns.spawnBullet(position, rightDir, /*damage*/ 8, /*range*/ 500.0f, /*speed*/ 280.0f, BulletType::PISTOL, /*enemyOwned*/ true);
+    }
+}
+
+void EnemyStore::updateMovement(float deltaTime, Vector2 playerPos, JobSystem& jobs) {
+    // Every enemy's movement and animation is independent of the others
+    jobs.parallelFor(chasers.size(), PARALLEL_GRAIN, [&](int begin, int end) {
+        moveTowards(chasers, begin, end, deltaTime, playerPos);
+        animate(chasers, begin, end, deltaTime);
+    });
+    jobs.parallelFor(shooters.body.size(), PARALLEL_GRAIN, [&](int begin, int end) {
+        moveTowards(shooters.body, begin, end, deltaTime, playerPos);
+        animate(shooters.body, begin, end, deltaTime);
+    });
+}
+
+void EnemyStore::updateAttacks(float deltaTime, Vector2 playerPos, SpawnQueue& spawns, JobSystem& jobs) {
+    // Spawns are deferred, so enemies only ever write their own state
+    jobs.parallelFor(shooters.body.size(), PARALLEL_GRAIN, [&](int begin, int end) {
+        fireShooters(begin, end, deltaTime, playerPos, spawns.forThread(jobs.getThreadIndex()));
+    });
+
+    // Bosses are few but each update is heavy: one job per boss
+    jobs.parallelFor(static_cast<int>(bosses.size()), 1, [&](int begin, int end) {
+        SpawnBuffer& buffer = spawns.forThread(jobs.getThreadIndex());
+        for (int i = begin; i < end; i++) {
+            buffer.beginSource(bossIds[i]);
+            bosses[i]->tickContactCooldown(deltaTime);
+            bosses[i]->update(deltaTime, playerPos, buffer);
+        }
+    });
+}
+
+// --- Rendering ---
+
+void EnemyStore::renderChasers(RenderQueue& queue) {
+    const int spriteSize = 64;
+    for (int i = 0; i < chasers.size(); i++) {
+        if (!chasers.alive[i]) continue;
+
+        // Choose the right frame based on state
+        const Sprite* sprite;
+        if (chasers.hit[i]) {
+            sprite = chaserHit.texture() ? &chaserHit : nullptr;
+        } else {
+            sprite = (chasers.frame[i] == 0 && chaserIdle1.texture()) ? &chaserIdle1 : &chaserIdle2;
+        }
+
+        Vector2 renderPos = queue.interpolate(Vector2(chasers.previousX[i], chasers.previousY[i]),
+                                              Vector2(chasers.positionX[i], chasers.positionY[i]));
+        if (sprite && sprite->texture()) {
+            SDL_Rect destRect = {(int)(renderPos.x - spriteSize / 2), (int)(renderPos.y - spriteSize / 2),
+                                 spriteSize, spriteSize};
+            queue.submitSprite(RenderLayer::ENEMIES, *sprite, destRect);
+        } else {
+            queue.submitCircle(RenderLayer::ENEMIES, (int)renderPos.x, (int)renderPos.y,
+                               (int)chasers.radius[i], {255, 50, 50, 255});
+        }
+    }
+}
+
+void EnemyStore::renderShooters(RenderQueue& queue) {
+    const EnemyGroup& body = shooters.body;
+    for (int i = 0; i < body.size(); i++) {
+        if (!body.alive[i]) continue;
+
+        bool isSlime = shooters.kind[i] == ShooterKind::SLIME;
+        const Sprite& sprite = isSlime ? slimeSprite : pebblinSprite;
+        Vector2 renderPos = queue.interpolate(Vector2(body.previousX[i], body.previousY[i]),
+                                              Vector2(body.positionX[i], body.positionY[i]));
+        if (sprite.texture()) {
+            float scale = isSlime ? 0.9f : 1.0f;
+            int sw = (int)(sprite.width() * scale);
+            int sh = (int)(sprite.height() * scale);
+            SDL_Rect dst{(int)(renderPos.x - sw / 2), (int)(renderPos.y - sh / 2), sw, sh};
+            queue.submitSprite(RenderLayer::ENEMIES, sprite, dst);
+        } else {
+            // Fallback circles: green slime, gray/brown rock
+            SDL_Color color = isSlime ? SDL_Color{80, 200, 80, 255} : SDL_Color{120, 100, 80, 255};
+            queue.submitCircle(RenderLayer::ENEMIES, (int)renderPos.x, (int)renderPos.y, (int)body.radius[i], color);
+        }
+    }
+}
+
+void EnemyStore::render(RenderQueue& queue) {
+    renderChasers(queue);
+    renderShooters(queue);
+    for (auto& boss : bosses) {
+        boss->render(queue);
+    }
+}
+
+// --- Handle access ---
+
+Vector2 EnemyStore::getPosition(EnemyHandle handle) const {
+    switch (handle.archetype) {
+        case EnemyArchetype::CHASER:
+            return Vector2(chasers.positionX[handle.index], chasers.positionY[handle.index]);
+        case EnemyArchetype::SHOOTER:
+            return Vector2(shooters.body.positionX[handle.index], shooters.body.positionY[handle.index]);
+        default:
+            return bosses[handle.index]->getPosition();
+    }
+}
+
+float EnemyStore::getRadius(EnemyHandle handle) const {
+    switch (handle.archetype) {
+        case EnemyArchetype::CHASER: return chasers.radius[handle.index];
+        case EnemyArchetype::SHOOTER: return shooters.body.radius[handle.index];
+        default: return bosses[handle.index]->getRadius();
+    }
+}
+
+void EnemyStore::getBounds(EnemyHandle handle, Vector2& center, float& radius) const {
+    if (isCompound(handle)) {
+        const CompoundCollider* collider = bosses[handle.index]->getCollider();
+        center = collider->getBoundsCenter();
+        radius = collider->getBoundsRadius();
+        return;
+    }
+    center = getPosition(handle);
+    radius = getRadius(handle);
+}
+
+bool EnemyStore::overlaps(EnemyHandle handle, Vector2 center, float radius) const {
+    if (isCompound(handle)) {
+        return bosses[handle.index]->getCollider()->overlaps(center, radius);
+    }
+    Vector2 offset = getPosition(handle) - center;
+    float range = radius + getRadius(handle);
+    return offset.x * offset.x + offset.y * offset.y < range * range;
+}
+
+float EnemyStore::sweep(EnemyHandle handle, Vector2 from, Vector2 to, float radius) const {
+    if (isCompound(handle)) {
+        float hitTime = 0.0f;
+        int part = bosses[handle.index]->getCollider()->sweep(from, to, radius, hitTime);
+        return part >= 0 ? hitTime : -1.0f;
+    }
+    Vector2 pos = getPosition(handle);
+    return sweepCircle(from.x, from.y, to.x, to.y, radius + getRadius(handle), pos.x, pos.y);
+}
+
+bool EnemyStore::isCompound(EnemyHandle handle) const {
+    if (handle.archetype != EnemyArchetype::BOSS) return false;
+    const CompoundCollider* collider = bosses[handle.index]->getCollider();
+    return collider && !collider->empty();
+}
+
+int EnemyStore::getDamage(EnemyHandle handle) const {
+    switch (handle.archetype) {
+        case EnemyArchetype::CHASER: return chasers.damage[handle.index];
+        case EnemyArchetype::SHOOTER: return shooters.body.damage[handle.index];
+        default: return bosses[handle.index]->getDamage();
+    }
+}
+
+uint32_t EnemyStore::getId(EnemyHandle handle) const {
+    switch (handle.archetype) {
+        case EnemyArchetype::CHASER: return chasers.id[handle.index];
+        case EnemyArchetype::SHOOTER: return shooters.body.id[handle.index];
+        default: return bossIds[handle.index];
+    }
+}
+
+bool EnemyStore::isAlive(EnemyHandle handle) const {
+    switch (handle.archetype) {
+        case EnemyArchetype::CHASER: return chasers.alive[handle.index] != 0;
+        case EnemyArchetype::SHOOTER: return shooters.body.alive[handle.index] != 0;
+        default: return bosses[handle.index]->isAlive();
+    }
+}
+
+bool EnemyStore::tryContact(EnemyHandle handle) {
+    if (handle.archetype != EnemyArchetype::BOSS) return true;
+    return bosses[handle.index]->tryContact();
+}
+
+void EnemyStore::takeDamage(EnemyHandle handle, int damage) {
+    if (handle.archetype == EnemyArchetype::BOSS) {
+        bosses[handle.index]->takeDamage(damage);
+        return;
+    }
+
+    EnemyGroup& group = (handle.archetype == EnemyArchetype::CHASER) ? chasers : shooters.body;
+    int i = handle.index;
+    group.health[i] -= damage;
+    if (group.health[i] <= 0) {
+        group.health[i] = 0;
+        group.alive[i] = 0;
+    }
+    // Show hit animation
+    group.hit[i] = 1;
+    group.hitTimer[i] = 0.0f;
+}
+
+void EnemyStore::destroy(EnemyHandle handle) {
+    switch (handle.archetype) {
+        case EnemyArchetype::CHASER: chasers.alive[handle.index] = 0; break;
+        case EnemyArchetype::SHOOTER: shooters.body.alive[handle.index] = 0; break;
+        default: bosses[handle.index]->destroy(); break;
+    }
+}
+
+int EnemyStore::countAlive() const {
+    int count = 0;
+    for (Uint8 alive : chasers.alive) count += alive;
+    for (Uint8 alive : shooters.body.alive) count += alive;
+    for (const auto& boss : bosses) {
+        if (boss->isAlive()) count++;
+    }
+    return count;
+}
+
+bool EnemyStore::hasLivingBoss() const {
+    for (const auto& boss : bosses) {
+        if (boss->isAlive()) return true;
+    }
+    return false;
+}
+
+void EnemyStore::clear() {
+    chasers.clear();
+    shooters.clear();
+    bosses.clear();
+    bossIds.clear();
+}
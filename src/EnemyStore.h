@@ -0,0 +1,180 @@
+#pragma once
+#include <SDL2/SDL.h>
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include "Vector2.h"
+#include "Enemy.h"
+#include "SpriteAtlas.h"
+#include "RenderQueue.h"
+
+class JobSystem;
+class SpawnBuffer;
+class SpawnQueue;
+
+enum class EnemyArchetype : Uint8 {
+    CHASER,  // Walks straight at the player (land monster)
+    SHOOTER, // Walks at the player and fires patterns (slime, pebblin)
+    BOSS     // Polymorphic Enemy subclasses
+};
+
+enum class ShooterKind : Uint8 {
+    SLIME,   // Single aimed shot
+    PEBBLIN  // Three-shot spread
+};
+
+// Refers to one enemy inside the store. Valid until the next removeDead().
+struct EnemyHandle {
+    EnemyArchetype archetype;
+    int index;
+};
+
+// Every enemy in the wave, grouped by archetype.
+// Chasers and shooters keep their hot fields (position, velocity, speed,
+// radius, health, timers) in dense per-archetype arrays updated by one batch
+// kernel each; bosses stay behind unique_ptr with virtual update/render.
+// Each enemy also gets a stable id that survives compaction.
+class EnemyStore {
+public:
+    EnemyStore();
+
+    // Shared sprites for the array archetypes; unload before the renderer goes away
+    void loadSprites(SDL_Renderer* renderer);
+    void unloadSprites();
+
+    uint32_t spawnChaser(Vector2 pos);
+    uint32_t spawnShooter(ShooterKind kind, Vector2 pos);
+    uint32_t addBoss(std::unique_ptr<Enemy> boss);
+
+    // Remembers positions at the start of a tick for render interpolation
+    void beginTick();
+    // Steering and animation of chasers and shooters, split across the job
+    // system; touches nothing outside the store
+    void updateMovement(float deltaTime, Vector2 playerPos, JobSystem& jobs);
+    // Shooter fire and boss updates, also split across the job system.
+    // Bullets go to the calling thread's buffer in `spawns`, tagged with the
+    // enemy's id; flush the queue once this returns.
+    void updateAttacks(float deltaTime, Vector2 playerPos, SpawnQueue& spawns, JobSystem& jobs);
+    void render(RenderQueue& queue);
+
+    // Calls fn(EnemyHandle) for every living enemy: chasers, shooters, bosses
+    template <typename Fn>
+    void forEachAlive(Fn&& fn) {
+        for (int i = 0; i < chasers.size(); i++) {
+            if (chasers.alive[i]) fn(EnemyHandle{EnemyArchetype::CHASER, i});
+        }
+        for (int i = 0; i < shooters.body.size(); i++) {
+            if (shooters.body.alive[i]) fn(EnemyHandle{EnemyArchetype::SHOOTER, i});
+        }
+        for (int i = 0; i < static_cast<int>(bosses.size()); i++) {
+            if (bosses[i]->isAlive()) fn(EnemyHandle{EnemyArchetype::BOSS, i});
+        }
+    }
+
+    // Swap-removes dead enemies, calling onDeath(id, position, isBoss) for each first
+    template <typename Fn>
+    void removeDead(Fn&& onDeath) {
+        for (int i = 0; i < chasers.size();) {
+            if (chasers.alive[i]) { i++; continue; }
+            onDeath(chasers.id[i], Vector2(chasers.positionX[i], chasers.positionY[i]), false);
+            chasers.swapRemove(i);
+        }
+        for (int i = 0; i < shooters.body.size();) {
+            if (shooters.body.alive[i]) { i++; continue; }
+            onDeath(shooters.body.id[i], Vector2(shooters.body.positionX[i], shooters.body.positionY[i]), false);
+            shooters.swapRemove(i);
+        }
+        for (size_t i = 0; i < bosses.size();) {
+            if (bosses[i]->isAlive()) { i++; continue; }
+            onDeath(bossIds[i], bosses[i]->getPosition(), true);
+            bosses.erase(bosses.begin() + i);
+            bossIds.erase(bossIds.begin() + i);
+        }
+    }
+
+    Vector2 getPosition(EnemyHandle handle) const;
+    float getRadius(EnemyHandle handle) const;
+    // Circle enclosing the whole enemy (every part of a compound boss)
+    void getBounds(EnemyHandle handle, Vector2& center, float& radius) const;
+    // Exact shape tests; compound bosses reject against their bounds first
+    bool overlaps(EnemyHandle handle, Vector2 center, float radius) const;
+    // Fraction in [0, 1] of the move from -> to at which a circle first touches
+    // the enemy, or -1
+    float sweep(EnemyHandle handle, Vector2 from, Vector2 to, float radius) const;
+    bool isCompound(EnemyHandle handle) const;
+    int getDamage(EnemyHandle handle) const;
+    uint32_t getId(EnemyHandle handle) const;
+    bool isAlive(EnemyHandle handle) const;
+    bool isBoss(EnemyHandle handle) const { return handle.archetype == EnemyArchetype::BOSS; }
+    void takeDamage(EnemyHandle handle, int damage);
+    // Whether touching the enemy hurts the player now; bosses rate-limit it
+    bool tryContact(EnemyHandle handle);
+    void destroy(EnemyHandle handle);
+
+    int countAlive() const;
+    bool hasLivingBoss() const;
+    void clear();
+
+private:
+    // Dense hot fields shared by chasers and shooters
+    struct EnemyGroup {
+        std::vector<uint32_t> id;
+        std::vector<float> positionX;
+        std::vector<float> positionY;
+        std::vector<float> previousX;
+        std::vector<float> previousY;
+        std::vector<float> velocityX;
+        std::vector<float> velocityY;
+        std::vector<float> speed;
+        std::vector<float> radius;
+        std::vector<int> health;
+        std::vector<int> damage;
+        std::vector<float> animationTimer;
+        std::vector<float> hitTimer;
+        std::vector<float> framePeriod; // Seconds between idle frames
+        std::vector<Uint8> hit;
+        std::vector<Uint8> frame;
+        std::vector<Uint8> alive;
+
+        int size() const { return static_cast<int>(id.size()); }
+        int add(uint32_t enemyId, Vector2 pos, float moveSpeed, float bodyRadius,
+                int hp, int contactDamage, float idleFramePeriod);
+        void swapRemove(int index);
+        void clear();
+        void reserve(int capacity);
+    };
+
+    struct ShooterGroup {
+        EnemyGroup body;
+        std::vector<ShooterKind> kind;
+        std::vector<float> fireCooldown;
+        std::vector<float> timeSinceLastShot;
+
+        int add(uint32_t enemyId, ShooterKind shooterKind, Vector2 pos);
+        void swapRemove(int index);
+        void clear();
+    };
+
+    // Batch kernels
+    static void moveTowards(EnemyGroup& group, int begin, int end, float deltaTime, Vector2 playerPos);
+    static void animate(EnemyGroup& group, int begin, int end, float deltaTime);
+    void fireShooters(int begin, int end, float deltaTime, Vector2 playerPos, SpawnBuffer& spawns);
+
+    void renderChasers(RenderQueue& queue);
+    void renderShooters(RenderQueue& queue);
+
+    EnemyGroup chasers;
+    ShooterGroup shooters;
+    std::vector<std::unique_ptr<Enemy>> bosses;
+    std::vector<uint32_t> bossIds;
+    uint32_t nextId;
+
+    Sprite chaserIdle1;
+    Sprite chaserIdle2;
+    Sprite chaserHit;
+    Sprite slimeSprite;
+    Sprite pebblinSprite;
+
+    static constexpr float HIT_FLASH_SECONDS = 0.2f;
+    static const int PARALLEL_GRAIN = 512; // Enemies per job
+};
@@ -0,0 +1,123 @@
+#include "FramePacer.h"
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+
+FramePacer::FramePacer()
+    : targetFps(60), vsync(false), uncapped(false),
+      frequency(SDL_GetPerformanceFrequency()), periodTicks(0), frameStart(0), nextDeadline(0),
+      started(false), samples{}, sampleCount(0), sampleIndex(0), missedFrames(0), frameCount(0) {
+    setTargetFps(targetFps);
+}
+
+void FramePacer::setTargetFps(int fps) {
+    targetFps = std::max(1, fps);
+    periodTicks = frequency / static_cast<Uint64>(targetFps);
+    nextDeadline = 0;
+}
+
+float FramePacer::beginFrame() {
+    Uint64 now = SDL_GetPerformanceCounter();
+    if (!started) {
+        started = true;
+        frameStart = now;
+        nextDeadline = now + periodTicks;
+        return 0.0f;
+    }
+
+    Uint64 elapsed = now - frameStart;
+    frameStart = now;
+    frameCount++;
+
+    float milliseconds = static_cast<float>(static_cast<double>(elapsed) * 1000.0 / static_cast<double>(frequency));
+    recordSample(milliseconds);
+
+    if (!uncapped && !vsync && elapsed > periodTicks + periodTicks / 2) {
+        missedFrames++;
+    }
+
+    return static_cast<float>(static_cast<double>(elapsed) / static_cast<double>(frequency));
+}
+
+void FramePacer::endFrame() {
+    if (uncapped || vsync) {
+        return;
+    }
+
+    Uint64 now = SDL_GetPerformanceCounter();
+    if (nextDeadline == 0 || now > nextDeadline + periodTicks) {
+        // Too far behind (or just reconfigured): restart the schedule from now
+        // instead of rushing several frames to catch up
+        nextDeadline = now + periodTicks;
+    }
+
+    Uint64 spinTicks = static_cast<Uint64>(SPIN_THRESHOLD_SECONDS * static_cast<double>(frequency));
+    while (now < nextDeadline) {
+        Uint64 remaining = nextDeadline - now;
+        if (remaining > spinTicks) {
+            // Coarse sleep, leaving the spin window for the OS to wake us late
+            Uint32 sleepMs = static_cast<Uint32>((remaining - spinTicks) * 1000 / frequency);
+            if (sleepMs > 0) {
+                SDL_Delay(sleepMs);
+            }
+        }
+        now = SDL_GetPerformanceCounter();
+    }
+
+    // Deadlines advance by exactly one period so rounding never accumulates
+    nextDeadline += periodTicks;
+}
+
+void FramePacer::recordSample(float milliseconds) {
+    samples[sampleIndex] = milliseconds;
+    sampleIndex = (sampleIndex + 1) % SAMPLE_COUNT;
+    if (sampleCount < SAMPLE_COUNT) {
+        sampleCount++;
+    }
+}
+
+float FramePacer::getAverageFrameMs() const {
+    if (sampleCount == 0) return 0.0f;
+    float total = 0.0f;
+    for (int i = 0; i < sampleCount; i++) {
+        total += samples[i];
+    }
+    return total / sampleCount;
+}
+
+float FramePacer::getMinFrameMs() const {
+    if (sampleCount == 0) return 0.0f;
+    return *std::min_element(samples, samples + sampleCount);
+}
+
+float FramePacer::getMaxFrameMs() const {
+    if (sampleCount == 0) return 0.0f;
+    return *std::max_element(samples, samples + sampleCount);
+}
+
+float FramePacer::getJitterMs() const {
+    if (sampleCount < 2) return 0.0f;
+    float average = getAverageFrameMs();
+    float variance = 0.0f;
+    for (int i = 0; i < sampleCount; i++) {
+        float diff = samples[i] - average;
+        variance += diff * diff;
+    }
+    return std::sqrt(variance / sampleCount);
+}
+
+float FramePacer::getFps() const {
+    float average = getAverageFrameMs();
+    return average > 0.0f ? 1000.0f / average : 0.0f;
+}
+
+void FramePacer::printSummary() const {
+    const char* mode = uncapped ? "uncapped" : (vsync ? "vsync" : "capped");
+    std::cout << "Frame pacing (" << mode;
+    if (!uncapped && !vsync) {
+        std::cout << " @ " << targetFps << " FPS";
+    }
+    std::cout << "): " << frameCount << " frames, avg " << getAverageFrameMs() << " ms ("
+              << getFps() << " FPS), min " << getMinFrameMs() << " ms, max " << getMaxFrameMs()
+              << " ms, jitter " << getJitterMs() << " ms, missed " << missedFrames << std::endl;
+}
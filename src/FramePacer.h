@@ -0,0 +1,62 @@
+#pragma once
+#include <SDL2/SDL.h>
+
+// Paces the main loop with the high-resolution performance counter.
+// - Capped: sleeps most of the way to the next deadline, then spins the
+//   last couple of milliseconds (SDL_Delay alone overshoots by a scheduler tick)
+// - Vsync: the renderer's present blocks, the pacer only measures
+// - Uncapped: no waiting at all, for benchmarking
+// Every frame's start-to-start interval is recorded for jitter statistics.
+class FramePacer {
+public:
+    FramePacer();
+
+    void setTargetFps(int fps);
+    int getTargetFps() const { return targetFps; }
+    void setVsync(bool enabled) { vsync = enabled; }
+    bool isVsync() const { return vsync; }
+    void setUncapped(bool enabled) { uncapped = enabled; }
+    bool isUncapped() const { return uncapped; }
+
+    // Call at the top of each frame; returns seconds since the previous frame began
+    float beginFrame();
+    // Call after presenting; waits for the next deadline when capped
+    void endFrame();
+
+    // Statistics over the last SAMPLE_COUNT frames, in milliseconds
+    float getAverageFrameMs() const;
+    float getMinFrameMs() const;
+    float getMaxFrameMs() const;
+    // Standard deviation of the frame interval
+    float getJitterMs() const;
+    float getFps() const;
+    // Frames that ran more than half a period late (total since start)
+    int getMissedFrames() const { return missedFrames; }
+    int getFrameCount() const { return frameCount; }
+
+    // Short summary to stdout, e.g. at shutdown of a benchmark run
+    void printSummary() const;
+
+private:
+    void recordSample(float milliseconds);
+
+    static const int SAMPLE_COUNT = 240;
+    // Below this much remaining time we spin instead of sleeping
+    static constexpr double SPIN_THRESHOLD_SECONDS = 0.002;
+
+    int targetFps;
+    bool vsync;
+    bool uncapped;
+
+    Uint64 frequency;
+    Uint64 periodTicks;
+    Uint64 frameStart;
+    Uint64 nextDeadline;
+    bool started;
+
+    float samples[SAMPLE_COUNT];
+    int sampleCount;
+    int sampleIndex;
+    int missedFrames;
+    int frameCount;
+};
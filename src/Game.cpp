@@ -1,8 +1,13 @@
 #include "Game.h"
-#include "SlimeEnemy.h"
-#include "PebblinEnemy.h"
 #include "BossEnemy.h"
 #include "SnakeBoss.h"
+#include "CircleCache.h"
+#include "TextureCache.h"
+#include "SpriteAtlas.h"
+#include "TextRenderer.h"
+#include "Profiler.h"
+#include "AllocationTracker.h"
+#include "AssetLoader.h"
 #include <cmath>
 #include <iostream>
 #include <random>
@@ -11,13 +16,21 @@
 #include <sstream>
 #include <iomanip>
 #include <cstdio> // Add for sprintf
+#include <chrono>
+#include <cstring>
 #include <string>
 #include <map>
+#include <cctype>
 
 Game::Game() : window(nullptr), renderer(nullptr), running(false), 
-               gameState(GameState::MENU), timeSinceLastSpawn(0), score(0), wave(1), mousePos(0, 0),
+               gameState(GameState::MENU), simulationThreaded(true), simulationRunning(false), accumulator(0.0f),
+               wavesCleared(0), texturesReleasedAt(0),
+               enemyGrid(WINDOW_WIDTH, WINDOW_HEIGHT, ENEMY_GRID_CELL_SIZE), frameArena(256 * 1024, "frame"), waveArena(64 * 1024, "wave"),
+               renderArena(16 * 1024, "render"),
+               timeSinceLastSpawn(0), score(0), wave(1), mousePos(0, 0),
                waveTimer(0), waveDuration(20.0f), waveActive(true), materialBag(0),
-               escCooldownTimer(0.0f), defaultFont(nullptr), bossSpawnedThisWave(false) {
+               escCooldownTimer(0.0f), showRenderStats(false), showProfiler(false), showAllocations(false),
+               bossSpawnedThisWave(false), combatRng(std::random_device{}()) {
 }
 
 Game::~Game() {
@@ -51,11 +64,34 @@ bool Game::init() {
         return false;
     }
     
-    renderer = SDL_CreateRenderer(window, -1, SDL_RENDERER_ACCELERATED);
+    Uint32 rendererFlags = SDL_RENDERER_ACCELERATED;
+    if (framePacer.isVsync() && !framePacer.isUncapped()) {
+        rendererFlags |= SDL_RENDERER_PRESENTVSYNC;
+    }
+    renderer = SDL_CreateRenderer(window, -1, rendererFlags);
     if (renderer == nullptr) {
         std::cout << "Renderer could not be created! SDL_Error: " << SDL_GetError() << std::endl;
         return false;
     }
+    renderQueue.setRenderer(renderer);
+    
+    spawnQueue.setThreadCount(jobs.getThreadCount());
+    contacts.setThreadCount(jobs.getThreadCount());
+    
+    // Everything below only queues its images and fonts; the loader decodes
+    // them in the background and run() uploads a few per frame, so the menu
+    // is up straight away and the rest streams in behind it
+    AssetLoader::start();
+    
+    mainMenu = std::make_unique<Menu>();
+    mainMenu->loadAssets(renderer);
+    
+    // Show menu immediately on startup
+    mainMenu->show(false);
+    
+    // Packed sprite atlas from the AtlasPacker build step (optional)
+    SpriteAtlas::load();
+    enemies.loadSprites(renderer);
     
     player = std::make_unique<Player>(WINDOW_WIDTH / 2, WINDOW_HEIGHT / 2);
     
@@ -69,34 +105,43 @@ bool Game::init() {
     shop->setGame(this);
     shop->loadAssets(renderer);
     
-    mainMenu = std::make_unique<Menu>();
-    mainMenu->loadAssets(renderer);
-    
-    // Show menu immediately on startup
-    mainMenu->show(false);
+    // Textures the simulation thread asks for later (bought weapons, bosses).
+    // It may request them itself, but prefetching means they are usually on
+    // screen from the first frame they are needed.
+    const char* simulationTextures[] = {
+        "assets/weapons/pistol.png",
+        "assets/weapons/pistol2.png",
+        "assets/weapons/pistol3.png",
+        "assets/weapons/smg.png",
+        "assets/weapons/brickonstick.png",
+        "assets/weapons/shotgun.png",
+        "assets/weapons/shotgun2.png",
+        "assets/enemies/rix.png"
+    };
+    for (const char* path : simulationTextures) {
+        SpriteAtlas::get(renderer, path, AssetPriority::LOW);
+    }
     
-    // Try to load fonts in order of preference
-    const char* fontPaths[] = {
+    // Stream the default size from the first font that loads; run() requests
+    // the other sizes the HUD and shop use once one has. Until then text
+    // falls back to the bitmap font.
+    std::vector<std::string> fontPaths = {
         "assets/fonts/default.ttf",
         "C:/Windows/Fonts/arial.ttf",
         "C:/Windows/Fonts/calibri.ttf",
         "C:/Windows/Fonts/consola.ttf"
     };
+    defaultFont.begin(renderer, fontPaths, {16}, AssetPriority::NORMAL);
     
-    defaultFont = nullptr;
-    for (const char* fontPath : fontPaths) {
-        defaultFont = TTF_OpenFont(fontPath, 16);
-        if (defaultFont) {
-            std::cout << "Loaded font: " << fontPath << std::endl;
-            break;
-        }
-    }
-    
-    if (!defaultFont) {
+    if (defaultFont.getPath().empty()) {
         std::cout << "No TTF font available - using bitmap fallback" << std::endl;
         // Continue without TTF font - will fall back to bitmap rendering
     }
     
+    if (AllocationTracker::ENABLED) {
+        AllocationTracker::openLog("allocations.log");
+    }
+    
     running = true;
     
     // Initialize boss wave configuration
@@ -106,35 +151,150 @@ bool Game::init() {
 }
 
 void Game::run() {
-    Uint32 lastTime = SDL_GetTicks();
+    if (simulationThreaded) {
+        // The job system belongs to the thread that starts it: the simulation
+        simulationRunning = true;
+        simulationThread = std::thread(&Game::simulationLoop, this);
+    } else {
+        jobs.start();
+    }
     
     while (running) {
-        Uint32 currentTime = SDL_GetTicks();
-        float deltaTime = (currentTime - lastTime) / 1000.0f;
-        lastTime = currentTime;
+        float frameTime = framePacer.beginFrame();
+        Profiler::beginFrame();
+        AllocationTracker::beginFrame();
+        renderArena.reset();
+        
+        pollEvents();
+        
+        // Anything uploaded may be art or text the cached shop panel was drawn without
+        if (AssetLoader::uploadPending(ASSET_UPLOAD_BUDGET_MS) > 0) {
+            shop->invalidatePanel();
+        }
+        updateFonts();
+        
+        if (!simulationThreaded) {
+            simulate(frameTime);
+        }
         
-        handleEvents();
-        update(deltaTime);
         render();
         
-        SDL_Delay(16);
+        // Pacing wait is idle time, keep it out of the profile
+        Profiler::endFrame();
+        AllocationTracker::endFrame();
+        framePacer.endFrame();
+    }
+    
+    stopSimulation();
+    framePacer.printSummary();
+}
+
+void Game::updateFonts() {
+    if (!defaultFont.update()) return;
+    
+    if (defaultFont.getPath().empty()) {
+        std::cout << "No TTF font could be loaded - using bitmap fallback" << std::endl;
+        return;
+    }
+    
+    std::cout << "Loaded font: " << defaultFont.getPath() << std::endl;
+    for (int fontSize : {12, 14, 18, 20, 24, 28}) {
+        TextRenderer::preloadAsync(renderer, defaultFont.getPath(), fontSize, AssetPriority::LOW);
+    }
+}
+
+void Game::simulationLoop() {
+    jobs.start();
+    
+    Uint64 frequency = SDL_GetPerformanceFrequency();
+    Uint64 previous = SDL_GetPerformanceCounter();
+    while (simulationRunning) {
+        Uint64 now = SDL_GetPerformanceCounter();
+        float frameTime = static_cast<float>(static_cast<double>(now - previous) / static_cast<double>(frequency));
+        previous = now;
+        
+        // Steps are this thread's profiler frames; the sleep stays out of them
+        Profiler::beginFrame(ProfileTrack::SIMULATION);
+        simulate(frameTime);
+        Profiler::endFrame();
+        
+        // Sleep until the next tick is due instead of spinning
+        float untilNextTick = FIXED_TIMESTEP - accumulator;
+        if (untilNextTick > 0.0f) {
+            std::this_thread::sleep_for(std::chrono::duration<float>(untilNextTick));
+        }
+    }
+    
+    jobs.stop();
+}
+
+void Game::stopSimulation() {
+    if (!simulationThread.joinable()) return;
+    simulationRunning = false;
+    simulationThread.join();
+}
+
+void Game::simulate(float frameTime) {
+    {
+        std::lock_guard<std::mutex> lock(inputMutex);
+        simulationInput = pendingInput;
     }
+    
+    std::lock_guard<std::mutex> lock(stateMutex);
+    frameArena.reset();
+    
+    // After a long stall (window drag, breakpoint) drop the backlog instead of
+    // running hundreds of ticks to catch up
+    if (frameTime > MAX_FRAME_TIME) {
+        frameTime = MAX_FRAME_TIME;
+    }
+    accumulator += frameTime;
+    
+    handleInput(simulationInput);
+    
+    // Simulation always advances in whole fixed ticks
+    while (accumulator >= FIXED_TIMESTEP) {
+        update(FIXED_TIMESTEP);
+        accumulator -= FIXED_TIMESTEP;
+    }
+    
+    publishSnapshot();
 }
 
-void Game::handleEvents() {
+void Game::pollEvents() {
+    PROFILE_ZONE("pollEvents");
+    ALLOC_SCOPE("input");
     SDL_Event e;
     while (SDL_PollEvent(&e) != 0) {
         if (e.type == SDL_QUIT) {
             running = false;
+        } else if (e.type == SDL_KEYDOWN && e.key.repeat == 0 && e.key.keysym.scancode == SDL_SCANCODE_F3) {
+            showRenderStats = !showRenderStats;
+        } else if (e.type == SDL_KEYDOWN && e.key.repeat == 0 && e.key.keysym.scancode == SDL_SCANCODE_F4) {
+            showProfiler = !showProfiler;
+            Profiler::setEnabled(showProfiler);
+        } else if (e.type == SDL_KEYDOWN && e.key.repeat == 0 && e.key.keysym.scancode == SDL_SCANCODE_F5) {
+            showAllocations = !showAllocations;
+        } else if (e.type == SDL_RENDER_TARGETS_RESET || e.type == SDL_RENDER_DEVICE_RESET) {
+            // Target texture contents are lost, redraw the cached shop panel
+            shop->invalidatePanel();
         }
     }
     
-    // Get mouse position
-    int mouseX, mouseY;
-    SDL_GetMouseState(&mouseX, &mouseY);
-    mousePos = Vector2(static_cast<float>(mouseX), static_cast<float>(mouseY));
-    
-    const Uint8* keyState = SDL_GetKeyboardState(nullptr);
+    // Hand this frame's keyboard and mouse to the simulation
+    int keyCount = 0;
+    const Uint8* keyState = SDL_GetKeyboardState(&keyCount);
+    std::lock_guard<std::mutex> lock(inputMutex);
+    std::memcpy(pendingInput.keys, keyState, std::min(keyCount, static_cast<int>(SDL_NUM_SCANCODES)));
+    pendingInput.mouseButtons = SDL_GetMouseState(&pendingInput.mouseX, &pendingInput.mouseY);
+}
+
+void Game::handleInput(const InputState& input) {
+    PROFILE_ZONE("handleInput");
+    ALLOC_SCOPE("input");
+    mousePos = Vector2(static_cast<float>(input.mouseX), static_cast<float>(input.mouseY));
+    const Uint8* keyState = input.keys;
+    bool mousePressed = (input.mouseButtons & SDL_BUTTON(SDL_BUTTON_LEFT)) != 0;
     
     if (gameState == GameState::MENU) {
         // Handle menu input including option selection
@@ -148,9 +308,7 @@ void Game::handleEvents() {
         }
         
         // Handle mouse input for menu
-        Uint32 mouseState = SDL_GetMouseState(&mouseX, &mouseY);
-        bool mousePressed = (mouseState & SDL_BUTTON(SDL_BUTTON_LEFT)) != 0;
-        mainMenu->handleMouseInput(mouseX, mouseY, mousePressed);
+        mainMenu->handleMouseInput(input.mouseX, input.mouseY, mousePressed);
         
         // Check if an option was selected
         if (mainMenu->isOptionSelected()) {
@@ -182,9 +340,7 @@ void Game::handleEvents() {
             shop->handleInput(keyState, *player);
             
             // Handle mouse input for shop
-            Uint32 mouseState = SDL_GetMouseState(&mouseX, &mouseY);
-            bool mousePressed = (mouseState & SDL_BUTTON(SDL_BUTTON_LEFT)) != 0;
-            shop->handleMouseInput(mouseX, mouseY, mousePressed, *player);
+            shop->handleMouseInput(input.mouseX, input.mouseY, mousePressed, *player);
         } else {
             player->handleInput(keyState);
             
@@ -195,6 +351,9 @@ void Game::handleEvents() {
 }
 
 void Game::update(float deltaTime) {
+    PROFILE_ZONE("update");
+    ALLOC_SCOPE("simulation");
+    
     // Update ESC cooldown timer for all game states
     if (escCooldownTimer > 0.0f) {
         escCooldownTimer -= deltaTime;
@@ -212,6 +371,10 @@ void Game::update(float deltaTime) {
         return;
     }
     
+    // Steady-state gameplay ticks should not touch the heap; violations
+    // (with the frame they happened in) go to the allocation log
+    ALLOC_BUDGET("simulation tick", 0);
+    
     // Check for game over condition
     if (player->getHealth() <= 0) {
         gameState = GameState::GAME_OVER;
@@ -230,7 +393,7 @@ void Game::update(float deltaTime) {
         
         // Check for wave completion conditions
         bool waveCompleted = false;
-        std::string completionReason = "";
+        const char* completionReason = "";
         
         if (waveTimer >= waveDuration) {
             waveCompleted = true;
@@ -272,116 +435,86 @@ void Game::update(float deltaTime) {
         }
     }
     
+    // Start of tick: remember positions for render interpolation
+    player->beginTick();
+    bullets.beginTick();
+    enemies.beginTick();
+    
     player->update(deltaTime);
     
     // Update weapons (they will fire in aim direction)
     player->updateWeapons(deltaTime, bullets);
     
-    for (auto& bullet : bullets) {
-        bullet->update(deltaTime);
-    }
-    
-    for (auto& enemy : enemies) {
-        enemy->update(deltaTime, player->getPosition(), bullets);
-    }
+    // Independent phases overlap on the job system. Enemy attacks wait for
+    // enemy movement (they fire from the new positions); their bullets are
+    // recorded in spawnQueue and only enter the pool after the graph, so they
+    // start moving next tick.
+    Vector2 playerPos = player->getPosition();
+    simulationGraph.clear();
+    int integrateBullets = simulationGraph.add([this, deltaTime]() {
+        jobs.parallelFor(bullets.size(), 1024, [&](int begin, int end) { bullets.update(deltaTime, begin, end); });
+    });
+    int moveEnemies = simulationGraph.add([this, deltaTime, playerPos]() {
+        enemies.updateMovement(deltaTime, playerPos, jobs);
+    });
+    int updatePickups = simulationGraph.add([this, deltaTime]() {
+        jobs.parallelFor(pickups.size(), 1024, [&](int begin, int end) { pickups.update(deltaTime, begin, end); });
+    });
+    int enemyAttacks = simulationGraph.add([this, deltaTime, playerPos]() {
+        enemies.updateAttacks(deltaTime, playerPos, spawnQueue, jobs);
+    });
+    simulationGraph.dependsOn(enemyAttacks, moveEnemies);
+    (void)integrateBullets;
+    (void)updatePickups;
+    simulationGraph.execute(jobs);
+    materialBag += spawnQueue.flush(bullets, pickups, MAX_MATERIALS_ON_MAP);
 
     updateSpawnIndicators(deltaTime);
     
-    for (auto& orb : experienceOrbs) {
-        orb->update(deltaTime);
-    }
-    
-    for (auto& material : materials) {
-        material->update(deltaTime);
-    }
-    
-    spawnEnemies();
+    spawnEnemies(deltaTime);
     checkCollisions();
     checkMeleeAttacks();
-    updateExperienceCollection();
-    updateMaterialCollection();
-    
-    bullets.erase(std::remove_if(bullets.begin(), bullets.end(),
-        [](const std::unique_ptr<Bullet>& bullet) {
-            return !bullet->isAlive();
-        }), bullets.end());
-    
-    enemies.erase(std::remove_if(enemies.begin(), enemies.end(),
-        [&](const std::unique_ptr<Enemy>& enemy) {
-            if (!enemy->isAlive()) {
-                // Brotato-style material drop system
-                float dropChance = getMaterialDropChance();
-                static std::random_device rd;
-                static std::mt19937 gen(rd());
-                std::uniform_real_distribution<float> dist(0.0f, 1.0f);
+    // Kill drops land before collection, so they can be picked up this tick
+    materialBag += spawnQueue.flush(bullets, pickups, MAX_MATERIALS_ON_MAP);
+    updatePickupCollection();
+    
+    bullets.expire();
+    bullets.compact();
+    
+    SpawnBuffer& drops = spawnQueue.forThread(jobs.getThreadIndex());
+    enemies.removeDead([&](uint32_t id, Vector2 position, bool isBoss) {
+        // Brotato-style material drop system
+        float dropChance = getMaterialDropChance();
+        std::uniform_real_distribution<float> dist(0.0f, 1.0f);
 
-                int baseValue = enemy->isBoss() ? 30 : 1;
-                
-                if (dist(gen) < dropChance) {
-                    // Check material limit on map
-                    if (materials.size() < MAX_MATERIALS_ON_MAP) {
-                        int matValue = baseValue + (wave / 3);
-                        int expValue = baseValue + (wave / 5);
-                        materials.push_back(std::make_unique<Material>(
-                            enemy->getPosition(), matValue, expValue
-                        ));
-                    } else {
-                        // Add to bag if map is full
-                        materialBag += baseValue + (wave / 3);
-                    }
-                }
-                
-                score += 10;
-                return true;
-            }
-            return false;
-        }), enemies.end());
-    
-    experienceOrbs.erase(std::remove_if(experienceOrbs.begin(), experienceOrbs.end(),
-        [](const std::unique_ptr<ExperienceOrb>& orb) {
-            return !orb->isAlive();
-        }), experienceOrbs.end());
-    
-    materials.erase(std::remove_if(materials.begin(), materials.end(),
-        [&](const std::unique_ptr<Material>& material) {
-            if (!material->isAlive()) {
-                // Add uncollected materials to bag
-                materialBag += material->getMaterialValue();
-                return true;
-            }
-            return false;
-        }), materials.end());
-}
-
-void Game::updateExperienceCollection() {
-    Vector2 playerPos = player->getPosition();
-    float pickupRange = player->getStats().pickupRange;
-    
-    for (auto& orb : experienceOrbs) {
-        if (orb->isAlive()) {
-            float distance = playerPos.distance(orb->getPosition());
-            if (distance <= pickupRange) {
-                player->gainExperience(orb->getExperienceValue());
-                orb->collect();
-            }
+        int baseValue = isBoss ? 30 : 1;
+        
+        if (dist(combatRng) < dropChance) {
+            // The flush bags whatever doesn't fit under the material limit on map
+            int matValue = baseValue + (wave / 3);
+            int expValue = baseValue + (wave / 5);
+            drops.beginSource(id);
+            drops.spawnMaterial(position, matValue, expValue);
         }
-    }
+        
+        score += 10;
+    });
+    materialBag += spawnQueue.flush(bullets, pickups, MAX_MATERIALS_ON_MAP);
+    
+    // Add materials that expired uncollected to the bag
+    materialBag += pickups.compact();
 }
 
-void Game::updateMaterialCollection() {
-    Vector2 playerPos = player->getPosition();
-    float pickupRange = player->getStats().pickupRange;
-    
-    for (auto& material : materials) {
-        if (material->isAlive()) {
-            float distance = playerPos.distance(material->getPosition());
-            if (distance <= pickupRange) {
-                // Materials provide both experience and gold/materials
-                player->gainExperience(material->getExperienceValue());
-                player->gainMaterials(material->getMaterialValue());
-                material->collect();
-            }
-        }
+void Game::updatePickupCollection() {
+    PROFILE_ZONE("updatePickupCollection");
+    PickupTotals collected = pickups.collectInRange(player->getPosition(), player->getStats().pickupRange);
+    
+    // Materials provide both experience and gold/materials
+    if (collected.experience > 0) {
+        player->gainExperience(collected.experience);
+    }
+    if (collected.materials > 0) {
+        player->gainMaterials(collected.materials);
     }
 }
 
@@ -400,48 +533,119 @@ float Game::getMaterialDropChance() const {
     return dropChance;
 }
 
+void Game::publishSnapshot() {
+    PROFILE_ZONE("publishSnapshot");
+    ALLOC_SCOPE("render");
+    
+    RenderSnapshot& snapshot = snapshots.beginWrite();
+    snapshot.showWorld = gameState == GameState::PLAYING;
+    snapshot.shopActive = snapshot.showWorld && shop->isShopActive();
+    snapshot.showMenu = gameState == GameState::MENU || gameState == GameState::GAME_OVER;
+    snapshot.leftoverSeconds = accumulator;
+    snapshot.wavesCleared = wavesCleared;
+    snapshot.publishedAt = SDL_GetPerformanceCounter();
+    snapshot.bullets.clear();
+    
+    worldQueue.clear();
+    if (snapshot.showWorld) {
+        player->render(worldQueue);
+        player->renderWeapons(worldQueue);
+        
+        enemies.render(worldQueue);
+        
+        // Spawn indicators on top of background but beneath UI; neither they
+        // nor pickups are interpolated
+        worldQueue.resetMotion();
+        renderSpawnIndicators();
+        
+        pickups.render(worldQueue);
+        worldQueue.sort();
+        ProjectileBatch::capture(bullets, snapshot.bullets);
+        
+        HudState& hud = snapshot.hud;
+        hud.health = player->getHealth();
+        hud.maxHealth = player->getStats().maxHealth;
+        hud.level = player->getLevel();
+        hud.materials = player->getStats().materials;
+        hud.wave = wave;
+        hud.secondsLeft = static_cast<int>(waveDuration - waveTimer);
+        hud.experience = player->getExperience();
+        hud.experienceToNextLevel = player->getExperienceToNextLevel();
+    }
+    // Swap rather than copy: the queue takes over this slot's old buffer
+    snapshot.commands.swap(worldQueue.getCommands());
+    
+    snapshots.publish();
+}
+
 void Game::render() {
+    PROFILE_ZONE("render");
+    ALLOC_SCOPE("render");
+    
     SDL_SetRenderDrawColor(renderer, 120, 110, 100, 255); // Light brown/tan background for better visibility
     SDL_RenderClear(renderer);
     
-    if (gameState == GameState::PLAYING) {
-        player->render(renderer);
-        player->renderWeapons(renderer);
+    const RenderSnapshot* snapshot = snapshots.acquire();
+    
+    // Textures nothing holds anymore can go once this snapshot, recorded after
+    // the wave's entities dropped their handles, replaces any that drew them
+    if (snapshot && snapshot->wavesCleared != texturesReleasedAt) {
+        texturesReleasedAt = snapshot->wavesCleared;
+        TextureCache::releaseUnused();
+    }
+    
+    if (snapshot && snapshot->showWorld) {
+        // Draw the fraction of a tick the simulation hasn't reached yet by
+        // interpolating between the snapshot's last two ticks
+        Uint64 elapsedTicks = SDL_GetPerformanceCounter() - snapshot->publishedAt;
+        float elapsed = static_cast<float>(static_cast<double>(elapsedTicks) /
+                                           static_cast<double>(SDL_GetPerformanceFrequency()));
+        float alpha = std::min(1.0f, (snapshot->leftoverSeconds + elapsed) / FIXED_TIMESTEP);
         
-        for (auto& bullet : bullets) {
-            bullet->render(renderer);
-        }
+        // Player and weapons, then bullets from their own batch, then everything above
+        renderQueue.resetStats();
+        renderQueue.draw(snapshot->commands, RenderLayer::PLAYER, RenderLayer::WEAPONS, alpha);
+        projectileBatch.render(renderer, snapshot->bullets, alpha);
+        renderQueue.draw(snapshot->commands, RenderLayer::PROJECTILES, RenderLayer::PICKUPS, alpha);
         
-        for (auto& enemy : enemies) {
-            enemy->render(renderer);
-        }
-
-        // Spawn indicators on top of background but beneath UI
-        renderSpawnIndicators();
+        renderUI(snapshot->hud);
         
-        for (auto& orb : experienceOrbs) {
-            orb->render(renderer);
+        if (showRenderStats) {
+            renderRenderStats(*snapshot);
         }
+    }
+    
+    // The shop and menu draw from live state. Both pause the world, so the
+    // simulation barely holds the lock while they are up.
+    if (snapshot && (snapshot->shopActive || snapshot->showMenu)) {
+        std::lock_guard<std::mutex> lock(stateMutex);
         
-        for (auto& material : materials) {
-            material->render(renderer);
+        // Render shop on top if active
+        if (gameState == GameState::PLAYING) {
+            shop->render(renderer, WINDOW_WIDTH, WINDOW_HEIGHT);
         }
         
-        renderUI();
-        
-        // Render shop on top if active
-        shop->render(renderer, WINDOW_WIDTH, WINDOW_HEIGHT);
+        // Render menu on top of everything if active
+        if (gameState == GameState::MENU || gameState == GameState::GAME_OVER) {
+            mainMenu->render(renderer, WINDOW_WIDTH, WINDOW_HEIGHT);
+        }
     }
     
-    // Render menu on top of everything if active
-    if (gameState == GameState::MENU || gameState == GameState::GAME_OVER) {
-        mainMenu->render(renderer, WINDOW_WIDTH, WINDOW_HEIGHT);
+    if (showProfiler) {
+        renderProfilerOverlay();
+    }
+    
+    if (showAllocations) {
+        renderAllocationPanel();
     }
     
     SDL_RenderPresent(renderer);
 }
 
-void Game::renderUI() {
+void Game::renderUI(const HudState& hud) {
+    PROFILE_ZONE("renderUI");
+    ALLOC_SCOPE("ui");
+    
     // === BROTATO-STYLE UI LAYOUT WITH BITMAP TEXT ===
     
     // Top-left: Health bar with actual numbers
@@ -450,7 +654,7 @@ void Game::renderUI() {
     SDL_RenderFillRect(renderer, &healthBg);
     
     SDL_SetRenderDrawColor(renderer, 255, 0, 0, 255); // Red health bar
-    int healthWidth = (player->getHealth() * 200) / player->getStats().maxHealth;
+    int healthWidth = (hud.health * 200) / hud.maxHealth;
     SDL_Rect healthBar = {20, 20, healthWidth, 35};
     SDL_RenderFillRect(renderer, &healthBar);
     
@@ -458,9 +662,10 @@ void Game::renderUI() {
     SDL_RenderDrawRect(renderer, &healthBg);
     
     // Health text "X / Y"
-    renderNumber(player->getHealth(), 30, 28, 2);
-    renderText(" / ", 30 + std::to_string(player->getHealth()).length() * 12, 28, 2);
-    renderNumber(player->getStats().maxHealth, 30 + std::to_string(player->getHealth()).length() * 12 + 24, 28, 2);
+    int healthDigits = static_cast<int>(std::strlen(renderArena.format("%d", hud.health)));
+    renderNumber(hud.health, 30, 28, 2);
+    renderText(" / ", 30 + healthDigits * 12, 28, 2);
+    renderNumber(hud.maxHealth, 30 + healthDigits * 12 + 24, 28, 2);
     
     // Top-left: Level display "LV.X"
     SDL_SetRenderDrawColor(renderer, 64, 64, 64, 255); // Dark gray background
@@ -472,32 +677,16 @@ void Game::renderUI() {
     
     // Level text
     renderText("LV.", 30, 72, 2);
-    renderNumber(player->getLevel(), 54, 72, 2);
+    renderNumber(hud.level, 54, 72, 2);
     
     // Top-left: Materials counter (green circle with actual number)
-    SDL_SetRenderDrawColor(renderer, 0, 100, 0, 255); // Dark green
-    // Draw circle
-    for (int x = -40; x <= 40; x++) {
-        for (int y = -40; y <= 40; y++) {
-            if (x*x + y*y <= 40*40) {
-                SDL_RenderDrawPoint(renderer, 70 + x, 150 + y);
-            }
-        }
-    }
-    
-    SDL_SetRenderDrawColor(renderer, 50, 200, 50, 255); // Brighter green inner circle
-    for (int x = -35; x <= 35; x++) {
-        for (int y = -35; y <= 35; y++) {
-            if (x*x + y*y <= 35*35) {
-                SDL_RenderDrawPoint(renderer, 70 + x, 150 + y);
-            }
-        }
-    }
+    CircleCache::drawFilled(renderer, 70, 150, 40, {0, 100, 0, 255}); // Dark green
+    CircleCache::drawFilled(renderer, 70, 150, 35, {50, 200, 50, 255}); // Brighter green inner circle
     
     // Materials number (centered in circle)
-    int materialDigits = std::to_string(player->getStats().materials).length();
+    int materialDigits = static_cast<int>(std::strlen(renderArena.format("%d", hud.materials)));
     int materialX = 70 - (materialDigits * 6); // Center the number
-    renderNumber(player->getStats().materials, materialX, 142, 2);
+    renderNumber(hud.materials, materialX, 142, 2);
     
     // Center top: Wave number with TTF text
     SDL_SetRenderDrawColor(renderer, 0, 0, 0, 200); // Semi-transparent black
@@ -508,19 +697,18 @@ void Game::renderUI() {
     SDL_RenderDrawRect(renderer, &waveBg);
     
     // Use TTF font for cleaner wave display, fallback to bitmap if TTF fails
-    if (defaultFont) {
+    if (!defaultFont.getPath().empty()) {
         SDL_Color waveColor = {255, 255, 255, 255};
-        std::string waveText = "WAVE " + std::to_string(wave);
-        renderTTFText(waveText.c_str(), WINDOW_WIDTH/2 - 40, 28, waveColor, 18);
+        const char* waveText = renderArena.format("WAVE %d", hud.wave);
+        renderTTFText(waveText, WINDOW_WIDTH/2 - 40, 28, waveColor, 18);
     } else {
         // Fallback to bitmap rendering with better spacing
         renderText("WAVE", WINDOW_WIDTH/2 - 50, 30, 2);
-        renderNumber(wave, WINDOW_WIDTH/2 + 10, 30, 2);
+        renderNumber(hud.wave, WINDOW_WIDTH/2 + 10, 30, 2);
     }
     
     // Center top: Countdown timer with actual numbers
-    float timeLeft = waveDuration - waveTimer;
-    int seconds = (int)timeLeft;
+    int seconds = hud.secondsLeft;
     
     SDL_SetRenderDrawColor(renderer, 0, 0, 0, 200); // Semi-transparent black
     SDL_Rect timerBg = {WINDOW_WIDTH/2 - 60, 70, 120, 60};
@@ -530,13 +718,13 @@ void Game::renderUI() {
     SDL_RenderDrawRect(renderer, &timerBg);
     
     // Large timer numbers using TTF (centered), fallback to bitmap
-    if (defaultFont) {
+    if (!defaultFont.getPath().empty()) {
         SDL_Color timerColor = {255, 255, 255, 255};
-        std::string timerText = std::to_string(seconds);
-        renderTTFText(timerText.c_str(), WINDOW_WIDTH/2 - 15, 80, timerColor, 28);
+        const char* timerText = renderArena.format("%d", seconds);
+        renderTTFText(timerText, WINDOW_WIDTH/2 - 15, 80, timerColor, 28);
     } else {
         // Fallback to bitmap rendering
-        int timerDigits = std::to_string(seconds).length();
+        int timerDigits = static_cast<int>(std::strlen(renderArena.format("%d", seconds)));
         int timerX = WINDOW_WIDTH/2 - (timerDigits * 12);
         renderNumber(seconds, timerX, 85, 4);
     }
@@ -548,13 +736,13 @@ void Game::renderUI() {
     
     // Experience progress (Brotato-style)
     SDL_SetRenderDrawColor(renderer, 0, 255, 0, 255); // Bright green
-    int expToNext = player->getExperienceToNextLevel();
-    int currentExp = player->getExperience();
+    int expToNext = hud.experienceToNextLevel;
+    int currentExp = hud.experience;
     
     // Calculate XP for current level using Brotato formula
     int expForCurrentLevel = 0;
-    if (player->getLevel() > 1) {
-        int currentLevel = player->getLevel();
+    if (hud.level > 1) {
+        int currentLevel = hud.level;
         expForCurrentLevel = (currentLevel + 3 - 1) * (currentLevel + 3 - 1);
     }
     
@@ -568,6 +756,216 @@ void Game::renderUI() {
     }
 }
 
+void Game::renderRenderStats(const RenderSnapshot& snapshot) {
+    // Debug line above the experience bar: how much the projectile batch saves
+    int y = WINDOW_HEIGHT - 40;
+    SDL_SetRenderDrawColor(renderer, 0, 0, 0, 200);
+    SDL_Rect statsBg = {10, y - 6, 620, 26};
+    SDL_RenderFillRect(renderer, &statsBg);
+    
+    renderText("BULLETS:", 20, y, 2);
+    renderNumber(projectileBatch.getBulletCount(), 20 + 9 * 12, y, 2);
+    renderText("DRAW CALLS:", 220, y, 2);
+    renderNumber(projectileBatch.getDrawCalls(), 220 + 12 * 12, y, 2);
+    renderText("SAVED:", 420, y, 2);
+    renderNumber(projectileBatch.getDrawCallsSaved(), 420 + 7 * 12, y, 2);
+    
+    // Second line: the sorted render queue for everything else in the world
+    y -= 30;
+    SDL_SetRenderDrawColor(renderer, 0, 0, 0, 200);
+    SDL_Rect queueBg = {10, y - 6, 620, 26};
+    SDL_RenderFillRect(renderer, &queueBg);
+    
+    renderText("SPRITES:", 20, y, 2);
+    renderNumber(static_cast<int>(snapshot.commands.size()), 20 + 9 * 12, y, 2);
+    renderText("DRAW CALLS:", 220, y, 2);
+    renderNumber(renderQueue.getDrawCalls(), 220 + 12 * 12, y, 2);
+    renderText("STATE:", 420, y, 2);
+    renderNumber(renderQueue.getStateChanges(), 420 + 7 * 12, y, 2);
+    
+    // Third line: frame pacing (frame time and jitter in microseconds)
+    y -= 30;
+    SDL_SetRenderDrawColor(renderer, 0, 0, 0, 200);
+    SDL_Rect pacingBg = {10, y - 6, 620, 26};
+    SDL_RenderFillRect(renderer, &pacingBg);
+    
+    renderText("FPS:", 20, y, 2);
+    renderNumber(static_cast<int>(framePacer.getFps() + 0.5f), 20 + 5 * 12, y, 2);
+    renderText("FRAME US:", 220, y, 2);
+    renderNumber(static_cast<int>(framePacer.getAverageFrameMs() * 1000.0f), 220 + 10 * 12, y, 2);
+    renderText("JITTER:", 420, y, 2);
+    renderNumber(static_cast<int>(framePacer.getJitterMs() * 1000.0f), 420 + 8 * 12, y, 2);
+    
+    // Fourth line: live texture caches (file textures drop at wave end)
+    y -= 30;
+    SDL_SetRenderDrawColor(renderer, 0, 0, 0, 200);
+    SDL_Rect cacheBg = {10, y - 6, 620, 26};
+    SDL_RenderFillRect(renderer, &cacheBg);
+    
+    renderText("TEXTURES:", 20, y, 2);
+    renderNumber(TextureCache::getTextureCount(), 20 + 10 * 12, y, 2);
+    renderText("CIRCLES:", 220, y, 2);
+    renderNumber(CircleCache::getTextureCount(), 220 + 9 * 12, y, 2);
+    renderText("FONTS:", 420, y, 2);
+    renderNumber(TextRenderer::getAtlasCount(), 420 + 7 * 12, y, 2);
+}
+
+void Game::renderProfilerOverlay() {
+    // Top-right panel: frame-time graph over the profiler history, then one
+    // zone table per track (the simulation's only while it has its own thread)
+    const int panelWidth = 520;
+    const int graphHeight = 80;
+    const int rowHeight = 20;
+    int zoneRows = 0;
+    for (int track = 0; track < static_cast<int>(ProfileTrack::COUNT); track++) {
+        Profiler::copyZones(static_cast<ProfileTrack>(track), profilerZones[track]);
+        zoneRows += static_cast<int>(profilerZones[track].size());
+    }
+    int panelX = WINDOW_WIDTH - panelWidth - 20;
+    int panelY = 120;
+    int panelHeight = graphHeight + 50 + (zoneRows + 1) * rowHeight;
+    
+    SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
+    SDL_SetRenderDrawColor(renderer, 0, 0, 0, 200);
+    SDL_Rect panelBg = {panelX, panelY, panelWidth, panelHeight};
+    SDL_RenderFillRect(renderer, &panelBg);
+    SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_NONE);
+    
+    // Graph scales to the worst recent frame, but never below a 60 FPS frame
+    int graphX = panelX + 10;
+    int graphY = panelY + 10;
+    int graphWidth = panelWidth - 20;
+    float scaleMs = std::max(Profiler::getFrameMaxMs(), 1000.0f / 60.0f);
+    const float* history = Profiler::getFrameHistory();
+    int start = Profiler::getFrameHistoryIndex();
+    float barWidth = static_cast<float>(graphWidth) / Profiler::HISTORY_FRAMES;
+    for (int i = 0; i < Profiler::HISTORY_FRAMES; i++) {
+        float ms = history[(start + i) % Profiler::HISTORY_FRAMES];
+        int barHeight = static_cast<int>(ms / scaleMs * graphHeight);
+        if (ms > 1000.0f / 60.0f) {
+            SDL_SetRenderDrawColor(renderer, 230, 80, 60, 255);
+        } else {
+            SDL_SetRenderDrawColor(renderer, 90, 200, 90, 255);
+        }
+        SDL_Rect bar = {graphX + static_cast<int>(i * barWidth), graphY + graphHeight - barHeight,
+                        std::max(1, static_cast<int>(barWidth)), barHeight};
+        SDL_RenderFillRect(renderer, &bar);
+    }
+    
+    // 60 FPS budget line
+    int budgetY = graphY + graphHeight - static_cast<int>((1000.0f / 60.0f) / scaleMs * graphHeight);
+    SDL_SetRenderDrawColor(renderer, 255, 255, 255, 255);
+    SDL_RenderDrawLine(renderer, graphX, budgetY, graphX + graphWidth, budgetY);
+    
+    // Zone table: name indented by depth, last/avg/max ms and calls this frame
+    const int columnX[5] = {graphX, graphX + 260, graphX + 320, graphX + 380, graphX + 440};
+    int rowY = graphY + graphHeight + 20;
+    const char* headers[5] = {"ZONE", "LAST", "AVG", "MAX", "CALLS"};
+    for (int column = 0; column < 5; column++) {
+        renderProfilerCell(headers[column], columnX[column], rowY);
+    }
+    
+    // Each track's root zone ("Frame", "Simulation") heads its section
+    char cell[64];
+    for (const auto& zones : profilerZones) {
+        for (const auto& zone : zones) {
+            rowY += rowHeight;
+            renderProfilerCell(zone.name, columnX[0] + zone.depth * 12, rowY);
+            std::snprintf(cell, sizeof(cell), "%.2f", zone.lastMs);
+            renderProfilerCell(cell, columnX[1], rowY);
+            std::snprintf(cell, sizeof(cell), "%.2f", zone.averageMs);
+            renderProfilerCell(cell, columnX[2], rowY);
+            std::snprintf(cell, sizeof(cell), "%.2f", zone.maxMs);
+            renderProfilerCell(cell, columnX[3], rowY);
+            std::snprintf(cell, sizeof(cell), "%d", zone.lastCalls);
+            renderProfilerCell(cell, columnX[4], rowY);
+        }
+    }
+}
+
+void Game::renderProfilerCell(const char* text, int x, int y) {
+    if (!defaultFont.getPath().empty()) {
+        SDL_Color white = {255, 255, 255, 255};
+        renderTTFText(text, x, y, white, 14);
+        return;
+    }
+    
+    // Bitmap font only has capitals
+    std::string upper = text;
+    std::transform(upper.begin(), upper.end(), upper.begin(),
+                   [](unsigned char c) { return static_cast<char>(std::toupper(c)); });
+    renderText(upper.c_str(), x, y, 1);
+}
+
+void Game::renderAllocationPanel() {
+    // Bottom-right panel: last frame's heap traffic, per subsystem and top call sites
+    const int panelWidth = 520;
+    const int rowHeight = 20;
+    const int maxSites = 8;
+    AllocationTracker::SubsystemStats subsystems[AllocationTracker::MAX_SUBSYSTEMS];
+    AllocationTracker::SiteStats sites[maxSites];
+    int subsystemCount = AllocationTracker::getSubsystems(subsystems, AllocationTracker::MAX_SUBSYSTEMS);
+    int siteCount = AllocationTracker::getTopSites(sites, maxSites);
+    
+    int rows = AllocationTracker::ENABLED ? 4 + subsystemCount + siteCount : 2;
+    int panelHeight = rows * rowHeight + 20;
+    int panelX = WINDOW_WIDTH - panelWidth - 20;
+    int panelY = WINDOW_HEIGHT - panelHeight - 20;
+    
+    SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
+    SDL_SetRenderDrawColor(renderer, 0, 0, 0, 200);
+    SDL_Rect panelBg = {panelX, panelY, panelWidth, panelHeight};
+    SDL_RenderFillRect(renderer, &panelBg);
+    SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_NONE);
+    
+    int x = panelX + 10;
+    int rowY = panelY + 10;
+    if (!AllocationTracker::ENABLED) {
+        renderProfilerCell("Allocation tracking is compiled out.", x, rowY);
+        renderProfilerCell("Configure with -DBROTATO_TRACK_ALLOCATIONS=ON", x, rowY + rowHeight);
+        return;
+    }
+    
+    // Cells are formatted into the frame arena so drawing the panel doesn't
+    // show up in its own numbers (beyond what text rendering itself does)
+    AllocationTracker::FrameStats frame = AllocationTracker::getLastFrame();
+    renderProfilerCell(renderArena.format("FRAME: %llu allocs  %llu frees  %llu bytes",
+                                         static_cast<unsigned long long>(frame.allocations),
+                                         static_cast<unsigned long long>(frame.frees),
+                                         static_cast<unsigned long long>(frame.bytes)), x, rowY);
+    rowY += rowHeight;
+    renderProfilerCell(renderArena.format("LIVE: %llu KB  PEAK: %llu KB  BUDGET MISSES: %d",
+                                         static_cast<unsigned long long>(AllocationTracker::getLiveBytes() / 1024),
+                                         static_cast<unsigned long long>(AllocationTracker::getPeakLiveBytes() / 1024),
+                                         AllocationTracker::getBudgetViolations()), x, rowY);
+    
+    const int columnX[3] = {x, x + 260, x + 360};
+    rowY += rowHeight;
+    renderProfilerCell("SUBSYSTEM", columnX[0], rowY);
+    renderProfilerCell("ALLOCS", columnX[1], rowY);
+    renderProfilerCell("BYTES", columnX[2], rowY);
+    for (int i = 0; i < subsystemCount; i++) {
+        rowY += rowHeight;
+        renderProfilerCell(subsystems[i].name, columnX[0], rowY);
+        renderProfilerCell(renderArena.format("%llu", static_cast<unsigned long long>(subsystems[i].frameAllocations)),
+                           columnX[1], rowY);
+        renderProfilerCell(renderArena.format("%llu", static_cast<unsigned long long>(subsystems[i].frameBytes)),
+                           columnX[2], rowY);
+    }
+    
+    // Call sites are totals since startup; the log has the full list
+    rowY += rowHeight;
+    renderProfilerCell("TOP SITES (TOTAL)", columnX[0], rowY);
+    for (int i = 0; i < siteCount; i++) {
+        rowY += rowHeight;
+        renderProfilerCell(renderArena.format("%p %s", sites[i].address, sites[i].subsystem), columnX[0], rowY);
+        renderProfilerCell(renderArena.format("%llu", static_cast<unsigned long long>(sites[i].allocations)),
+                           columnX[1], rowY);
+        renderProfilerCell(renderArena.format("%llu", static_cast<unsigned long long>(sites[i].bytes)),
+                           columnX[2], rowY);
+    }
+}
+
 void Game::renderNumber(int number, int x, int y, int scale) {
     // Simple 5x7 bitmap font for digits 0-9
     static int digitPatterns[10][7] = {
@@ -681,33 +1079,19 @@ void Game::renderText(const char* text, int x, int y, int scale) {
 }
 
 void Game::renderTTFText(const char* text, int x, int y, SDL_Color color, int fontSize) {
-    if (!defaultFont) return; // Fall back to bitmap rendering if no TTF font
-    
-    // Create surface from text
-    SDL_Surface* textSurface = TTF_RenderText_Blended(defaultFont, text, color);
-    if (!textSurface) {
-        std::cout << "Unable to render text surface! SDL_ttf Error: " << TTF_GetError() << std::endl;
-        return;
-    }
+    if (TextRenderer::draw(renderer, defaultFont.getPath(), fontSize, text, x, y, color)) return;
     
-    // Create texture from surface
-    SDL_Texture* textTexture = SDL_CreateTextureFromSurface(renderer, textSurface);
-    if (!textTexture) {
-        std::cout << "Unable to create texture from text! SDL Error: " << SDL_GetError() << std::endl;
-        SDL_FreeSurface(textSurface);
-        return;
+    // No TTF font, or its atlas is still streaming in: bitmap font, which only has capitals
+    char upper[128];
+    size_t length = 0;
+    for (; text[length] != '\0' && length < sizeof(upper) - 1; length++) {
+        upper[length] = static_cast<char>(std::toupper(static_cast<unsigned char>(text[length])));
     }
-    
-    // Render texture
-    SDL_Rect destRect = {x, y, textSurface->w, textSurface->h};
-    SDL_RenderCopy(renderer, textTexture, nullptr, &destRect);
-    
-    // Clean up
-    SDL_FreeSurface(textSurface);
-    SDL_DestroyTexture(textTexture);
+    upper[length] = '\0';
+    renderText(upper, x, y, std::max(1, fontSize / 8));
 }
 
-void Game::spawnEnemies() {
+void Game::spawnEnemies(float deltaTime) {
     // If boss is already spawned/planned for this wave, don't spawn regular enemies
     if (bossSpawnedThisWave) {
         return;
@@ -721,7 +1105,7 @@ void Game::spawnEnemies() {
         return; // Don't spawn regular enemies on boss wave
     }
     
-    timeSinceLastSpawn += 0.016f;
+    timeSinceLastSpawn += deltaTime;
     
     float spawnRate = 1.0f - (wave * 0.1f);
     if (spawnRate < 0.2f) spawnRate = 0.2f;
@@ -767,30 +1151,31 @@ void Game::updateSpawnIndicators(float deltaTime) {
     }
 
     // Spawn enemies for completed indicators, then remove them
-    std::vector<SpawnIndicator> remaining;
+    ArenaVector<SpawnIndicator> remaining{ArenaAllocator<SpawnIndicator>(frameArena)};
     remaining.reserve(spawnIndicators.size());
     for (auto& indicator : spawnIndicators) {
         if (indicator.isComplete()) {
             switch (indicator.enemyType) {
                 case EnemySpawnType::SLIME:
-                    enemies.push_back(CreateSlimeEnemy(indicator.position, renderer));
+                    enemies.spawnShooter(ShooterKind::SLIME, indicator.position);
                     break;
                 case EnemySpawnType::PEBBLIN:
-                    enemies.push_back(CreatePebblinEnemy(indicator.position, renderer));
+                    enemies.spawnShooter(ShooterKind::PEBBLIN, indicator.position);
                     break;
                 case EnemySpawnType::BOSS:
-                    enemies.push_back(CreateSnakeBoss(indicator.position, renderer, wave));
+                    enemies.addBoss(CreateSnakeBoss(indicator.position, wave));
                     break;
                 case EnemySpawnType::BASE:
                 default:
-                    enemies.push_back(std::make_unique<Enemy>(indicator.position, renderer));
+                    enemies.spawnChaser(indicator.position);
                     break;
             }
         } else {
             remaining.push_back(indicator);
         }
     }
-    spawnIndicators.swap(remaining);
+    // Copy back into the existing buffer; its capacity is reused
+    spawnIndicators.assign(remaining.begin(), remaining.end());
 }
 
 void Game::renderSpawnIndicators() {
@@ -799,62 +1184,153 @@ void Game::renderSpawnIndicators() {
         float t = indicator.elapsed;
         float flash = fmodf(t * 6.0f, 2.0f) < 1.0f ? 255.0f : 80.0f; // blink ~3 Hz
         Uint8 alpha = static_cast<Uint8>(flash);
-        SDL_SetRenderDrawColor(renderer, 200, 0, 0, alpha);
+        SDL_Color color = {200, 0, 0, alpha};
 
         int size = 14; // cross arm length
         int cx = static_cast<int>(indicator.position.x);
         int cy = static_cast<int>(indicator.position.y);
-        // 4 short lines to make an X
-        for (int i = -size; i <= size; ++i) {
-            SDL_RenderDrawPoint(renderer, cx + i, cy + i);
-            SDL_RenderDrawPoint(renderer, cx + i, cy - i);
-        }
+        // 2 diagonal lines to make an X
+        worldQueue.submitLine(RenderLayer::INDICATORS, cx - size, cy - size, cx + size, cy + size, color);
+        worldQueue.submitLine(RenderLayer::INDICATORS, cx - size, cy + size, cx + size, cy - size, color);
     }
 }
 
 void Game::checkCollisions() {
-    for (auto& bullet : bullets) {
-        if (!bullet->isAlive()) continue;
-        if (bullet->isEnemyOwned()) {
-            // enemy bullets damage the player
-            float d = bullet->getPosition().distance(player->getPosition());
-            if (d < bullet->getRadius() + player->getRadius()) {
-                player->takeDamage(bullet->getDamage());
-                bullet->destroy();
+    PROFILE_ZONE("checkCollisions");
+    
+    // Enemies don't move during collision checks, so one rebuild serves every bullet
+    enemyGrid.clear();
+    gridEnemies.clear();
+    // Compound bosses go in by their bounding circle
+    enemies.forEachAlive([&](EnemyHandle enemy) {
+        Vector2 center;
+        float radius = 0.0f;
+        enemies.getBounds(enemy, center, radius);
+        enemyGrid.insert(center.x, center.y, radius);
+        gridEnemies.push_back(enemy);
+    });
+    enemyGrid.build();
+    
+    // Query phase: read-only and parallel. Each thread records what it finds
+    // in its own contact list; nothing is damaged or destroyed yet.
+    Vector2 playerPos = player->getPosition();
+    float playerRadius = player->getRadius();
+    jobs.parallelFor(bullets.size(), 256, [&](int begin, int end) {
+        std::vector<Contact>& found = contacts.forThread(jobs.getThreadIndex());
+        for (int i = begin; i < end; i++) {
+            if (!bullets.isAlive(i)) continue;
+            if (bullets.isEnemyOwned(i)) {
+                // enemy bullets damage the player; sweep the whole move this tick
+                Vector2 from = bullets.getPreviousPosition(i);
+                Vector2 to = bullets.getPosition(i);
+                float t = sweepCircle(from.x, from.y, to.x, to.y, bullets.getRadius(i) + playerRadius,
+                                      playerPos.x, playerPos.y);
+                if (t >= 0.0f) {
+                    found.push_back(Contact{ContactKind::BULLET, i, 0, -1});
+                }
+                continue;
+            }
+            int hit = findBulletHit(i);
+            if (hit >= 0) {
+                found.push_back(Contact{ContactKind::BULLET, i, enemies.getId(gridEnemies[hit]), hit});
             }
-            continue;
         }
-        for (auto& enemy : enemies) {
-            if (bullet->isAlive() && enemy->isAlive()) {
-                float distance = bullet->getPosition().distance(enemy->getPosition());
-                if (distance < bullet->getRadius() + enemy->getRadius()) {
-                    bullet->destroy();
-                    bool wasAlive = enemy->isAlive();
-                    enemy->takeDamage(bullet->getDamage());
-                    
-                    // Create experience orb if enemy died from this shot
-                    if (wasAlive && !enemy->isAlive()) {
-                        experienceOrbs.push_back(std::make_unique<ExperienceOrb>(enemy->getPosition()));
-                    }
-                }
+    });
+    jobs.parallelFor(static_cast<int>(gridEnemies.size()), 256, [&](int begin, int end) {
+        std::vector<Contact>& found = contacts.forThread(jobs.getThreadIndex());
+        for (int item = begin; item < end; item++) {
+            EnemyHandle enemy = gridEnemies[item];
+            if (enemies.overlaps(enemy, playerPos, playerRadius)) {
+                found.push_back(Contact{ContactKind::BODY, -1, enemies.getId(enemy), item});
             }
         }
-    }
-    
-    for (auto& enemy : enemies) {
-        if (enemy->isAlive()) {
-            float distance = player->getPosition().distance(enemy->getPosition());
-            if (distance < player->getRadius() + enemy->getRadius()) {
-                player->takeDamage(enemy->getDamage());
-                enemy->destroy();
+    });
+    
+    // Resolve phase: serial, bullets in slot order, then enemies touching the
+    // player in id order. Kills only shrink the set of targets, so a bullet's
+    // contact stays correct while its enemy is alive; otherwise (or for
+    // bosses, whose segments can fall off) that bullet is re-queried. The
+    // outcome is the same as checking each bullet serially.
+    SpawnBuffer& drops = spawnQueue.forThread(jobs.getThreadIndex());
+    for (const Contact& contact : contacts.sorted()) {
+        if (contact.kind == ContactKind::BODY) {
+            EnemyHandle enemy = gridEnemies[contact.target];
+            if (!enemies.isAlive(enemy)) continue; // Shot down this tick
+            if (enemies.isCompound(enemy) && !enemies.overlaps(enemy, playerPos, playerRadius)) continue;
+            if (enemies.isBoss(enemy)) {
+                // Any boss segment hurts on a cooldown; touching it never kills the boss
+                if (enemies.tryContact(enemy)) {
+                    player->takeDamage(enemies.getDamage(enemy));
+                }
+                continue;
             }
+            player->takeDamage(enemies.getDamage(enemy));
+            enemies.destroy(enemy);
+            continue;
+        }
+        
+        int i = contact.source;
+        if (contact.target < 0) {
+            player->takeDamage(bullets.getDamage(i));
+            bullets.destroy(i);
+            continue;
+        }
+        
+        int hit = contact.target;
+        if (!enemies.isAlive(gridEnemies[hit]) || enemies.isCompound(gridEnemies[hit])) {
+            hit = findBulletHit(i);
+            if (hit < 0) continue;
+        }
+        
+        EnemyHandle enemy = gridEnemies[hit];
+        Vector2 enemyPos = enemies.getPosition(enemy);
+        bullets.destroy(i);
+        enemies.takeDamage(enemy, bullets.getDamage(i));
+        
+        // Create experience orb if enemy died from this shot
+        if (!enemies.isAlive(enemy)) {
+            drops.beginSource(enemies.getId(enemy));
+            drops.spawnExperience(enemyPos);
         }
     }
 }
 
+int Game::findBulletHit(int bullet) const {
+    if (!bullets.isAlive(bullet) || bullets.isEnemyOwned(bullet)) return -1;
+    
+    // Sweep the whole move this tick so fast bullets or long ticks can't step
+    // over a target. Earliest enemy along the path wins, ties go to store
+    // order. For compound bosses the grid's time is only against their
+    // bounds, so refine it against the parts (it can only get later).
+    Vector2 from = bullets.getPreviousPosition(bullet);
+    Vector2 to = bullets.getPosition(bullet);
+    float bulletRadius = bullets.getRadius(bullet);
+    int hit = -1;
+    float hitTime = 2.0f;
+    enemyGrid.querySwept(from.x, from.y, to.x, to.y, bulletRadius, [&](int item, float t) {
+        EnemyHandle enemy = gridEnemies[item];
+        if (t > hitTime || (t == hitTime && item > hit) || !enemies.isAlive(enemy)) return;
+        if (enemies.isCompound(enemy)) {
+            t = enemies.sweep(enemy, from, to, bulletRadius);
+            if (t < 0.0f || t > hitTime || (t == hitTime && item > hit)) return;
+        }
+        hit = item;
+        hitTime = t;
+    });
+    return hit;
+}
+
 void Game::checkMeleeAttacks() {
+    PROFILE_ZONE("checkMeleeAttacks");
+    // Damage each weapon deals this tick; crits are rolled in weapon order so
+    // combatRng is consumed the same way every run
+    int strikeDamage[Player::MAX_WEAPONS];
+    SpawnBuffer& drops = spawnQueue.forThread(jobs.getThreadIndex());
+    std::vector<Contact>& found = contacts.forThread(jobs.getThreadIndex());
+    
     // Check if player has any melee weapons that are currently attacking
-    for (int i = 0; i < player->getWeaponCount(); i++) {
+    int weaponCount = std::min(player->getWeaponCount(), static_cast<int>(Player::MAX_WEAPONS));
+    for (int i = 0; i < weaponCount; i++) {
         const Weapon* weapon = player->getWeapon(i);
         if (weapon && weapon->isMeleeWeapon() && weapon->isAttacking()) {
             // Only damage during the peak of the attack (when weapon is most extended)
@@ -869,48 +1345,65 @@ void Game::checkMeleeAttacks() {
             int meleeDamage = weapon->calculateDamage(*player);
             
             // Check for critical hit
-            static std::random_device rd;
-            static std::mt19937 gen(rd());
             std::uniform_real_distribution<float> critRoll(0.0f, 1.0f);
-            
-            if (critRoll(gen) < weapon->getStats().critChance) {
+            if (critRoll(combatRng) < weapon->getStats().critChance) {
                 meleeDamage = (int)(meleeDamage * weapon->getStats().critMultiplier);
             }
+            strikeDamage[i] = meleeDamage;
             
-            // Damage all enemies within damage radius of weapon tip (Brotato-style infinite pierce)
-            for (auto& enemy : enemies) {
-                if (enemy->isAlive()) {
-                    float distance = weaponTip.distance(enemy->getPosition());
-                    if (distance <= damageRadius + enemy->getRadius()) {
-                        bool wasAlive = enemy->isAlive();
-                        enemy->takeDamage(meleeDamage);
-                        
-                        // Only drop rewards if enemy died from this attack
-                        if (wasAlive && !enemy->isAlive()) {
-                            // Create experience orb at enemy position
-                            experienceOrbs.push_back(std::make_unique<ExperienceOrb>(enemy->getPosition()));
-                            
-                            // Chance to drop materials
-                            static std::random_device matRd;
-                            static std::mt19937 matGen(matRd());
-                            std::uniform_real_distribution<float> matChance(0.0f, 1.0f);
-                            
-                            if (matChance(matGen) < getMaterialDropChance()) {
-                                materials.push_back(std::make_unique<Material>(enemy->getPosition()));
-                            }
-                        }
-                    }
+            // Every enemy within damage radius of weapon tip (Brotato-style infinite pierce).
+            // Only a handful of grid queries, so they run on this thread.
+            enemyGrid.query(weaponTip.x, weaponTip.y, damageRadius, [&](int item) {
+                EnemyHandle enemy = gridEnemies[item];
+                if (enemies.isAlive(enemy) && enemies.overlaps(enemy, weaponTip, damageRadius)) {
+                    found.push_back(Contact{ContactKind::MELEE, i, enemies.getId(enemy), item});
                 }
+            });
+        }
+    }
+    
+    // Resolve in weapon order, then enemy id
+    for (const Contact& contact : contacts.sorted()) {
+        EnemyHandle enemy = gridEnemies[contact.target];
+        if (!enemies.isAlive(enemy)) continue; // An earlier weapon got it
+        
+        Vector2 enemyPos = enemies.getPosition(enemy);
+        enemies.takeDamage(enemy, strikeDamage[contact.source]);
+        
+        // Only drop rewards if enemy died from this attack
+        if (!enemies.isAlive(enemy)) {
+            // Create experience orb at enemy position
+            drops.beginSource(contact.enemyId);
+            drops.spawnExperience(enemyPos);
+            
+            // Chance to drop materials
+            std::uniform_real_distribution<float> matChance(0.0f, 1.0f);
+            if (matChance(combatRng) < getMaterialDropChance()) {
+                drops.spawnMaterial(enemyPos);
             }
         }
     }
 }
 
 void Game::cleanup() {
-    if (defaultFont) {
-        TTF_CloseFont(defaultFont);
-        defaultFont = nullptr;
+    stopSimulation();
+    AllocationTracker::writeReport();
+    AllocationTracker::closeLog();
+    jobs.stop();
+    // Before the caches below: loader threads write into glyph atlases
+    AssetLoader::stop();
+    
+    // Release everything holding textures while the renderer is still alive
+    enemies.clear();
+    enemies.unloadSprites();
+    player.reset();
+    if (shop) {
+        shop->unloadAssets();
     }
+    SpriteAtlas::clear();
+    TextureCache::clear();
+    CircleCache::clear();
+    TextRenderer::clear();
     
     if (renderer) {
         SDL_DestroyRenderer(renderer);
@@ -948,8 +1441,7 @@ void Game::resetGameState() {
     enemies.clear();
     bullets.clear();
     spawnIndicators.clear();
-    experienceOrbs.clear();
-    materials.clear();
+    pickups.clear();
     
     // Reset game variables
     timeSinceLastSpawn = 0;
@@ -959,6 +1451,8 @@ void Game::resetGameState() {
     waveDuration = 20.0f;
     waveActive = true;
     materialBag = 0;
+    spawnQueue.clear();
+    contacts.clear();
     
     // Reset boss system
     bossSpawnedThisWave = false;
@@ -1014,13 +1508,8 @@ bool Game::isBossDefeated() const {
     }
     
     // Check if any boss enemy is still alive
-    for (const auto& enemy : enemies) {
-        // Check if this enemy is a boss
-        if (enemy->isBoss()) {
-            if (enemy->isAlive()) {
-                return false; // Boss is still alive
-            }
-        }
+    if (enemies.hasLivingBoss()) {
+        return false;
     }
     
     // Boss was spawned, not in indicators, and no living boss found = boss defeated
@@ -1032,33 +1521,19 @@ void Game::clearWaveEntities() {
     int clearedExperience = 0;
     int collectedMaterials = 0;
     
+    // Wave-scoped scratch (previous shop's item names) is done with
+    waveArena.reset();
+    
     // Count and clear all enemies (no rewards for unkilled enemies)
-    for (auto& enemy : enemies) {
-        if (enemy->isAlive()) {
-            clearedEnemies++;
-        }
-    }
+    clearedEnemies = enemies.countAlive();
     enemies.clear();
     
-    // Clear all experience orbs and add their value to material bag
-    for (auto& orb : experienceOrbs) {
-        if (orb->isAlive()) {
-            clearedExperience++;
-            // Convert experience orbs to materials (1:1 ratio for simplicity)
-            materialBag += 1;
-            collectedMaterials += 1;
-        }
-    }
-    experienceOrbs.clear();
-    
-    // Clear all materials and add their value to material bag
-    for (auto& material : materials) {
-        if (material->isAlive()) {
-            materialBag += material->getMaterialValue();
-            collectedMaterials += material->getMaterialValue();
-        }
-    }
-    materials.clear();
+    // Clear all pickups and add their value to material bag:
+    // experience orbs convert 1:1 to materials for simplicity
+    PickupTotals leftover = pickups.drain();
+    clearedExperience = leftover.experienceOrbs;
+    materialBag += leftover.experienceOrbs + leftover.materials;
+    collectedMaterials += leftover.experienceOrbs + leftover.materials;
     
     // Clear any remaining bullets
     bullets.clear();
@@ -1066,6 +1541,10 @@ void Game::clearWaveEntities() {
     // Clear spawn indicators
     spawnIndicators.clear();
     
+    // Bosses, and weapons sold since the last wave, have let go of their
+    // sprites; render() frees the textures on the main thread
+    wavesCleared++;
+    
     if (clearedEnemies > 0 || clearedExperience > 0 || collectedMaterials > 0) {
         std::cout << "Wave completed! Cleared from map - Enemies: " << clearedEnemies 
                   << ", Experience orbs: " << clearedExperience 
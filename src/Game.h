@@ -1,22 +1,32 @@
 #pragma once
 #include <SDL2/SDL.h>
 #include <SDL2/SDL_ttf.h>
+#include <atomic>
 #include <vector>
 #include <memory>
 #include <map>
+#include <mutex>
+#include <random>
+#include <string>
+#include <thread>
 #include "Player.h"
-#include "Enemy.h"
-#include "Bullet.h"
-#include "ExperienceOrb.h"
-#include "Material.h"
+#include "EnemyStore.h"
+#include "BulletPool.h"
+#include "PickupPool.h"
 #include "Weapon.h"
 #include "Shop.h"
 #include "Menu.h"
-
-// Forward declarations
-class SlimeEnemy;
-class PebblinEnemy;
-class BossEnemy;
+#include "ProjectileBatch.h"
+#include "RenderQueue.h"
+#include "RenderSnapshot.h"
+#include "FramePacer.h"
+#include "MemoryArena.h"
+#include "SpatialGrid.h"
+#include "JobSystem.h"
+#include "SpawnQueue.h"
+#include "ContactList.h"
+#include "TextRenderer.h"
+#include "Profiler.h"
 
 enum class EnemySpawnType {
     BASE,
@@ -58,6 +68,16 @@ public:
     int getPlayerMaterials() const { return player ? player->getStats().materials : 0; }
     const Player* getPlayer() const { return player.get(); }
     SDL_Renderer* getRenderer() const { return renderer; }
+    // Simulation scratch memory: reset every simulation step / when a wave is cleared
+    MemoryArena& getFrameArena() { return frameArena; }
+    MemoryArena& getWaveArena() { return waveArena; }
+    // Configure before init(): vsync is chosen when the renderer is created
+    FramePacer& getFramePacer() { return framePacer; }
+    // Configure the worker count before run(), which starts the workers
+    JobSystem& getJobSystem() { return jobs; }
+    // Configure before run(). Off runs the simulation between frames on the
+    // main thread again, e.g. to see its zones in the profiler.
+    void setSimulationThreaded(bool threaded) { simulationThreaded = threaded; }
     
     // Game state management
     void showMenu(bool canContinue = false);
@@ -65,31 +85,83 @@ public:
     void resetGameState();
     
 private:
-    void handleEvents();
+    // Keyboard and mouse as of the last pollEvents(), for the simulation
+    struct InputState {
+        Uint8 keys[SDL_NUM_SCANCODES] = {};
+        int mouseX = 0;
+        int mouseY = 0;
+        Uint32 mouseButtons = 0;
+    };
+    
+    // Main thread: SDL events and input capture
+    void pollEvents();
+    // Main thread: moves on to the next font candidate or requests the HUD sizes
+    void updateFonts();
+    // Simulation side: menu, shop and player input
+    void handleInput(const InputState& input);
+    // Input, then every fixed tick due, then a snapshot. Holds stateMutex.
+    void simulate(float frameTime);
+    void simulationLoop();
+    void stopSimulation();
+    void publishSnapshot();
     void update(float deltaTime);
+    // Draws the latest snapshot, plus the menu and shop from live state
     void render();
-    void spawnEnemies();
+    void spawnEnemies(float deltaTime);
     void updateSpawnIndicators(float deltaTime);
     void renderSpawnIndicators();
     void checkCollisions();
+    // Earliest living enemy (grid item) a player bullet hits this tick, or -1.
+    // Read-only, so it can run for many bullets at once.
+    int findBulletHit(int bullet) const;
     void checkMeleeAttacks();
-    void updateExperienceCollection();
-    void updateMaterialCollection();
+    void updatePickupCollection();
     float getMaterialDropChance() const;
-    void renderUI();
+    void renderUI(const HudState& hud);
     void clearWaveEntities();
     
     SDL_Window* window;
     SDL_Renderer* renderer;
-    bool running;
+    std::atomic<bool> running;
     GameState gameState;
     
+    // Simulation thread. It owns all game state while it steps (stateMutex)
+    // and the main thread only draws published snapshots, so rendering and
+    // presenting overlap the next ticks.
+    bool simulationThreaded;
+    std::atomic<bool> simulationRunning;
+    std::thread simulationThread;
+    std::mutex stateMutex;
+    float accumulator; // Simulated time not yet consumed by a tick
+    std::mutex inputMutex;
+    InputState pendingInput;    // Written by pollEvents(), under inputMutex
+    InputState simulationInput; // The simulation's copy for this step
+    SnapshotBuffer snapshots;
+    // Wave ends are where entities drop texture handles; the main thread
+    // releases unused textures once it draws a snapshot from after one
+    int wavesCleared;
+    int texturesReleasedAt;
+    
     std::unique_ptr<Player> player;
-    std::vector<std::unique_ptr<Enemy>> enemies;
-    std::vector<std::unique_ptr<Bullet>> bullets;
+    EnemyStore enemies; // Chasers and shooters in dense arrays, bosses polymorphic
+    BulletPool bullets;
     std::vector<SpawnIndicator> spawnIndicators;
-    std::vector<std::unique_ptr<ExperienceOrb>> experienceOrbs;
-    std::vector<std::unique_ptr<Material>> materials;
+    PickupPool pickups; // Experience orbs and materials
+    
+    // Broadphase for player bullets, rebuilt from the living enemies each tick.
+    // Grid item i is gridEnemies[i].
+    SpatialGrid enemyGrid;
+    std::vector<EnemyHandle> gridEnemies;
+    ContactList contacts; // Per-thread collision query results
+    
+    JobSystem jobs;
+    TaskGraph simulationGraph; // Per-tick phases and their dependencies
+    SpawnQueue spawnQueue; // Deferred bullet/pickup spawns, one buffer per job thread
+    
+    // Transient allocations (see MemoryArena)
+    MemoryArena frameArena;
+    MemoryArena waveArena;
+    MemoryArena renderArena; // Main thread text formatting, reset every frame
     
     float timeSinceLastSpawn;
     int score;
@@ -116,7 +188,24 @@ private:
     static constexpr float ESC_COOLDOWN_DURATION = 0.3f; // 300ms cooldown
     
     // TTF Font system
-    TTF_Font* defaultFont;
+    FontChooser defaultFont; // Path is empty when no TTF font could be loaded
+    
+    // Batched projectile rendering
+    ProjectileBatch projectileBatch;
+    // World objects submit to worldQueue on the simulation side; renderQueue
+    // draws the recorded commands from snapshots on the main thread
+    RenderQueue worldQueue;
+    RenderQueue renderQueue;
+    bool showRenderStats; // Toggled with F3
+    bool showProfiler; // Toggled with F4, also enables zone timing
+    void renderProfilerOverlay();
+    // Copies of each profiler track's zones, reused between overlay frames
+    std::vector<Profiler::Zone> profilerZones[static_cast<int>(ProfileTrack::COUNT)];
+    void renderProfilerCell(const char* text, int x, int y);
+    bool showAllocations; // Toggled with F5
+    void renderAllocationPanel();
+    FramePacer framePacer;
+    void renderRenderStats(const RenderSnapshot& snapshot);
     
     // Telegraph duration for spawn indicators (seconds)
     float spawnTelegraphSeconds = 2.0f;
@@ -125,11 +214,23 @@ private:
     bool bossSpawnedThisWave;
     std::map<int, bool> bossWaves;  // wave number -> boss enabled
     
+    // Crit and drop rolls, drawn only in the serial resolve phases so the
+    // sequence doesn't depend on thread scheduling
+    std::mt19937 combatRng;
+    
     void initializeBossWaves();
     bool shouldSpawnBoss() const;
     Vector2 getBossSpawnPosition() const;
     bool isBossDefeated() const;
     
+    // Fixed simulation tick; rendering interpolates between ticks
+    static constexpr float FIXED_TIMESTEP = 1.0f / 120.0f;
+    static constexpr float MAX_FRAME_TIME = 0.25f;
+    // Main-thread time per frame spent turning streamed assets into textures
+    static constexpr float ASSET_UPLOAD_BUDGET_MS = 2.0f;
+    
     static const int WINDOW_WIDTH = 1920;
     static const int WINDOW_HEIGHT = 1080;
+    // Regular enemies are 26-30px radius, so one cell holds roughly one enemy
+    static constexpr float ENEMY_GRID_CELL_SIZE = 64.0f;
 };
\ No newline at end of file
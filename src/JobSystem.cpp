@@ -0,0 +1,215 @@
+#include "JobSystem.h"
+#include <iostream>
+
+namespace {
+// Queue index of the current thread in the running JobSystem, -1 for threads
+// it doesn't know (they submit to the owner's queue)
+thread_local int workerQueue = -1;
+}
+
+JobSystem::JobSystem()
+    : workerCount(getDefaultWorkerCount()), running(false), queuedJobs(0), stopping(false) {
+}
+
+JobSystem::~JobSystem() {
+    stop();
+}
+
+int JobSystem::getDefaultWorkerCount() {
+    // Leave one core for the thread that starts the system (the simulation,
+    // which also runs jobs while it waits) and one for rendering
+    int cores = static_cast<int>(std::thread::hardware_concurrency());
+    return std::max(0, std::min(cores - 2, 7));
+}
+
+void JobSystem::setWorkerCount(int count) {
+    if (running) {
+        std::cout << "JobSystem: worker count can only change before start()" << std::endl;
+        return;
+    }
+    workerCount = std::max(0, count);
+}
+
+void JobSystem::start() {
+    if (running) return;
+
+    queues.clear();
+    for (int i = 0; i <= workerCount; i++) {
+        queues.push_back(std::make_unique<WorkerQueue>());
+    }
+
+    stopping = false;
+    ownerThread = std::this_thread::get_id();
+    workerQueue = 0;
+    running = true;
+    for (int i = 1; i <= workerCount; i++) {
+        workers.emplace_back(&JobSystem::workerLoop, this, i);
+    }
+    std::cout << "Job system started with " << workerCount << " worker thread(s)" << std::endl;
+}
+
+void JobSystem::stop() {
+    if (!running) return;
+    // Queue 0 and the thread's queue index belong to the thread that called start()
+    assert(std::this_thread::get_id() == ownerThread);
+
+    {
+        std::lock_guard<std::mutex> lock(sleepMutex);
+        stopping = true;
+    }
+    wakeCondition.notify_all();
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    workers.clear();
+    queues.clear();
+    running = false;
+    workerQueue = -1;
+}
+
+int JobSystem::currentQueue() const {
+    if (workerQueue >= 0 && workerQueue < static_cast<int>(queues.size())) {
+        return workerQueue;
+    }
+    return 0;
+}
+
+void JobSystem::submit(const Job& job) {
+    job.counter->pending.fetch_add(1, std::memory_order_relaxed);
+
+    WorkerQueue& queue = *queues[currentQueue()];
+    bool queued = false;
+    {
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        if (queue.tail - queue.head < QUEUE_CAPACITY) {
+            queue.jobs[queue.tail % QUEUE_CAPACITY] = job;
+            queue.tail++;
+            queuedJobs.fetch_add(1, std::memory_order_release);
+            queued = true;
+        }
+    }
+    if (!queued) {
+        // Full: do the work here rather than grow the queue
+        Job inlineJob = job;
+        execute(inlineJob);
+        return;
+    }
+
+    // Taking the lock orders this wake-up after a sleeper's predicate check
+    { std::lock_guard<std::mutex> lock(sleepMutex); }
+    wakeCondition.notify_one();
+}
+
+bool JobSystem::popLocal(int queueIndex, Job& job) {
+    WorkerQueue& queue = *queues[queueIndex];
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    if (queue.head == queue.tail) return false;
+    queue.tail--;
+    job = queue.jobs[queue.tail % QUEUE_CAPACITY];
+    if (queue.head == queue.tail) {
+        queue.head = queue.tail = 0;
+    }
+    queuedJobs.fetch_sub(1, std::memory_order_relaxed);
+    return true;
+}
+
+bool JobSystem::steal(int thief, Job& job) {
+    int count = static_cast<int>(queues.size());
+    for (int offset = 1; offset < count; offset++) {
+        WorkerQueue& queue = *queues[(thief + offset) % count];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        if (queue.head == queue.tail) continue;
+        job = queue.jobs[queue.head % QUEUE_CAPACITY];
+        queue.head++;
+        if (queue.head == queue.tail) {
+            queue.head = queue.tail = 0;
+        }
+        queuedJobs.fetch_sub(1, std::memory_order_relaxed);
+        return true;
+    }
+    return false;
+}
+
+bool JobSystem::tryRunOne(int queueIndex) {
+    Job job;
+    if (popLocal(queueIndex, job) || steal(queueIndex, job)) {
+        execute(job);
+        return true;
+    }
+    return false;
+}
+
+void JobSystem::execute(Job& job) {
+    JobCounter* counter = job.counter;
+    job.invoke(job);
+    counter->pending.fetch_sub(1, std::memory_order_release);
+}
+
+void JobSystem::wait(JobCounter& counter) {
+    int queueIndex = currentQueue();
+    while (counter.pending.load(std::memory_order_acquire) > 0) {
+        if (!tryRunOne(queueIndex)) {
+            // Remaining jobs are running on other threads
+            std::this_thread::yield();
+        }
+    }
+}
+
+void JobSystem::workerLoop(int queueIndex) {
+    workerQueue = queueIndex;
+    while (true) {
+        if (tryRunOne(queueIndex)) continue;
+
+        std::unique_lock<std::mutex> lock(sleepMutex);
+        wakeCondition.wait(lock, [this]() {
+            return stopping.load() || queuedJobs.load(std::memory_order_acquire) > 0;
+        });
+        if (stopping && queuedJobs.load() == 0) {
+            return;
+        }
+    }
+}
+
+// --- TaskGraph ---
+
+TaskGraph::TaskGraph() : taskCount(0) {
+}
+
+void TaskGraph::dependsOn(int task, int prerequisite) {
+    Task& before = tasks[prerequisite];
+    assert(before.successorCount < MAX_SUCCESSORS);
+    before.successors[before.successorCount++] = task;
+    tasks[task].prerequisites++;
+}
+
+void TaskGraph::execute(JobSystem& jobs) {
+    for (int i = 0; i < taskCount; i++) {
+        tasks[i].remaining.store(tasks[i].prerequisites, std::memory_order_relaxed);
+    }
+
+    // Successors are queued from inside their last prerequisite's job, before
+    // that job counts as finished, so the counter can't hit zero early
+    JobCounter counter;
+    for (int i = 0; i < taskCount; i++) {
+        if (tasks[i].prerequisites == 0) {
+            schedule(jobs, counter, i);
+        }
+    }
+    jobs.wait(counter);
+}
+
+void TaskGraph::schedule(JobSystem& jobs, JobCounter& counter, int task) {
+    TaskGraph* graph = this;
+    JobSystem* system = &jobs;
+    JobCounter* done = &counter;
+    jobs.run(counter, [graph, system, done, task]() {
+        Task& current = graph->tasks[task];
+        current.invoke(current);
+        for (int i = 0; i < current.successorCount; i++) {
+            int next = current.successors[i];
+            if (graph->tasks[next].remaining.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                graph->schedule(*system, *done, next);
+            }
+        }
+    });
+}
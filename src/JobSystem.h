@@ -0,0 +1,198 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <condition_variable>
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+// Counts outstanding jobs; wait() on it until they have all finished
+struct JobCounter {
+    std::atomic<int> pending{0};
+};
+
+// Work-stealing thread pool.
+// Each worker (and the thread that calls start(), usually the main thread)
+// owns a deque: it pushes and pops its own jobs at the back, and idle threads
+// steal from the front of others. wait() runs jobs instead of blocking, so
+// nested parallelFor calls inside jobs are fine.
+//
+// Jobs are small callables (lambdas capturing references, pointers and
+// indices) copied into fixed-size slots, so submitting work never allocates.
+// With zero workers, or before start(), every job runs inline on the
+// submitting thread, which keeps a debugger's call stacks simple.
+//
+// The Profiler is single-threaded: keep PROFILE_ZONE out of job bodies.
+class JobSystem {
+public:
+    static const int QUEUE_CAPACITY = 1024;
+    static const size_t JOB_STORAGE = 64;
+
+    JobSystem();
+    ~JobSystem();
+
+    // Worker threads besides the calling thread; set before start()
+    void setWorkerCount(int count);
+    int getWorkerCount() const { return workerCount; }
+    static int getDefaultWorkerCount();
+
+    void start();
+    void stop();
+    bool isParallel() const { return running && workerCount > 0; }
+
+    // Calling thread's index in [0, getThreadCount()), for per-thread scratch
+    // buffers; 0 is the thread that called start()
+    int getThreadIndex() const { return currentQueue(); }
+    int getThreadCount() const { return workerCount + 1; }
+
+    // Queues fn() and counts it on `counter`. Runs inline when not parallel
+    // or when this thread's queue is full.
+    template <typename Fn>
+    void run(JobCounter& counter, Fn fn) {
+        static_assert(sizeof(Fn) <= JOB_STORAGE, "job captures too much; capture by reference instead");
+        static_assert(std::is_trivially_copyable<Fn>::value && std::is_trivially_destructible<Fn>::value,
+                      "jobs must be trivially copyable (capture references, pointers and numbers)");
+        if (!isParallel()) {
+            fn();
+            return;
+        }
+
+        Job job;
+        job.invoke = [](Job& self) {
+            Fn* callable = reinterpret_cast<Fn*>(self.storage);
+            (*callable)();
+        };
+        job.counter = &counter;
+        std::memcpy(job.storage, &fn, sizeof(Fn));
+        submit(job);
+    }
+
+    // Runs jobs (this thread's first, then stolen ones) until counter reaches zero
+    void wait(JobCounter& counter);
+
+    // Calls fn(begin, end) over [0, count) in chunks of at least grainSize,
+    // spread across the workers, and returns when every chunk is done.
+    // The calling thread takes the first chunk itself.
+    template <typename Fn>
+    void parallelFor(int count, int grainSize, Fn&& fn) {
+        if (count <= 0) return;
+        if (grainSize < 1) grainSize = 1;
+
+        // A few chunks per thread lets stealing even out uneven chunks
+        int threads = workerCount + 1;
+        int chunks = (count + grainSize - 1) / grainSize;
+        chunks = std::min(chunks, threads * 4);
+        if (!isParallel() || chunks <= 1) {
+            fn(0, count);
+            return;
+        }
+
+        JobCounter counter;
+        int chunkSize = (count + chunks - 1) / chunks;
+        auto* body = &fn;
+        for (int begin = chunkSize; begin < count; begin += chunkSize) {
+            int end = std::min(begin + chunkSize, count);
+            run(counter, [body, begin, end]() { (*body)(begin, end); });
+        }
+        fn(0, std::min(chunkSize, count));
+        wait(counter);
+    }
+
+private:
+    struct Job {
+        void (*invoke)(Job& self);
+        JobCounter* counter;
+        alignas(std::max_align_t) unsigned char storage[JOB_STORAGE];
+    };
+
+    // Fixed ring buffer; the owner works at the tail, thieves at the head.
+    // A mutex per queue keeps it simple, and contention is low because each
+    // thread mostly touches its own.
+    struct WorkerQueue {
+        std::mutex mutex;
+        Job jobs[QUEUE_CAPACITY];
+        int head = 0;
+        int tail = 0; // One past the newest job; head == tail means empty
+    };
+
+    void submit(const Job& job);
+    bool popLocal(int queue, Job& job);
+    bool steal(int thief, Job& job);
+    bool tryRunOne(int queue);
+    void execute(Job& job);
+    void workerLoop(int queue);
+    int currentQueue() const;
+
+    int workerCount;
+    bool running;
+    std::vector<std::unique_ptr<WorkerQueue>> queues; // [0] is the thread that called start()
+    std::vector<std::thread> workers;
+    std::thread::id ownerThread; // Only this thread may stop() the system
+
+    std::atomic<int> queuedJobs;
+    std::atomic<bool> stopping;
+    std::mutex sleepMutex;
+    std::condition_variable wakeCondition;
+};
+
+// Small dependency graph of tasks, executed on a JobSystem. Tasks with no
+// unfinished prerequisites run concurrently; each task's successors are
+// queued as soon as their last prerequisite finishes.
+//
+//     TaskGraph graph;
+//     int move = graph.add([&]() { ... });
+//     int fire = graph.add([&]() { ... });
+//     graph.dependsOn(fire, move);
+//     graph.execute(jobs);
+class TaskGraph {
+public:
+    static const int MAX_TASKS = 16;
+    static const int MAX_SUCCESSORS = 8;
+
+    TaskGraph();
+
+    // Same capture rules as JobSystem::run; returns the task's index
+    template <typename Fn>
+    int add(Fn fn) {
+        static_assert(sizeof(Fn) <= JobSystem::JOB_STORAGE, "task captures too much; capture by reference instead");
+        static_assert(std::is_trivially_copyable<Fn>::value && std::is_trivially_destructible<Fn>::value,
+                      "tasks must be trivially copyable (capture references, pointers and numbers)");
+        assert(taskCount < MAX_TASKS);
+        Task& task = tasks[taskCount];
+        task.invoke = [](Task& self) {
+            Fn* callable = reinterpret_cast<Fn*>(self.storage);
+            (*callable)();
+        };
+        std::memcpy(task.storage, &fn, sizeof(Fn));
+        task.prerequisites = 0;
+        task.successorCount = 0;
+        return taskCount++;
+    }
+
+    // `task` starts only after `prerequisite` has finished
+    void dependsOn(int task, int prerequisite);
+
+    // Runs every task, returns when all have finished. The graph can be executed again.
+    void execute(JobSystem& jobs);
+    void clear() { taskCount = 0; }
+
+private:
+    struct Task {
+        void (*invoke)(Task& self);
+        alignas(std::max_align_t) unsigned char storage[JobSystem::JOB_STORAGE];
+        int prerequisites;
+        int successors[MAX_SUCCESSORS];
+        int successorCount;
+        std::atomic<int> remaining;
+    };
+
+    void schedule(JobSystem& jobs, JobCounter& counter, int task);
+
+    Task tasks[MAX_TASKS];
+    int taskCount;
+};
@@ -0,0 +1,70 @@
+#include "MemoryArena.h"
+#include <cstdarg>
+#include <cstdint>
+#include <cstdio>
+#include <iostream>
+
+MemoryArena::MemoryArena(size_t initialCapacity, const char* arenaName)
+    : name(arenaName), block(new unsigned char[initialCapacity]), capacity(initialCapacity),
+      used(0), highWater(0), overflowUsed(0) {
+}
+
+MemoryArena::~MemoryArena() {
+}
+
+void* MemoryArena::allocate(size_t size, size_t alignment) {
+    if (size == 0) size = 1;
+
+    uintptr_t base = reinterpret_cast<uintptr_t>(block.get());
+    uintptr_t aligned = (base + used + alignment - 1) & ~(static_cast<uintptr_t>(alignment) - 1);
+    size_t offset = static_cast<size_t>(aligned - base);
+
+    if (offset + size <= capacity) {
+        used = offset + size;
+        if (getUsed() > highWater) highWater = getUsed();
+        return block.get() + offset;
+    }
+
+    // Out of room: a dedicated heap block for this request, kept until reset()
+    if (overflow.empty()) {
+        std::cout << "Arena '" << name << "' overflowed " << capacity << " bytes, growing on next reset" << std::endl;
+    }
+    overflow.emplace_back(new unsigned char[size + alignment]);
+    overflowUsed += size + alignment;
+    if (getUsed() > highWater) highWater = getUsed();
+
+    uintptr_t raw = reinterpret_cast<uintptr_t>(overflow.back().get());
+    uintptr_t alignedRaw = (raw + alignment - 1) & ~(static_cast<uintptr_t>(alignment) - 1);
+    return reinterpret_cast<void*>(alignedRaw);
+}
+
+const char* MemoryArena::format(const char* fmt, ...) {
+    va_list args;
+    va_start(args, fmt);
+    va_list measureArgs;
+    va_copy(measureArgs, args);
+    int length = std::vsnprintf(nullptr, 0, fmt, measureArgs);
+    va_end(measureArgs);
+
+    if (length < 0) {
+        va_end(args);
+        return "";
+    }
+
+    char* text = static_cast<char*>(allocate(static_cast<size_t>(length) + 1, 1));
+    std::vsnprintf(text, static_cast<size_t>(length) + 1, fmt, args);
+    va_end(args);
+    return text;
+}
+
+void MemoryArena::reset() {
+    if (!overflow.empty()) {
+        // Grow once to what this frame/wave actually needed
+        size_t newCapacity = highWater + highWater / 4;
+        overflow.clear();
+        block.reset(new unsigned char[newCapacity]);
+        capacity = newCapacity;
+    }
+    used = 0;
+    overflowUsed = 0;
+}
@@ -0,0 +1,78 @@
+#pragma once
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+// Linear (bump) allocator for short-lived data. allocate() just advances an
+// offset; nothing is freed individually, reset() drops everything at once.
+//
+// Game owns two: a frame arena reset at the top of every frame for scratch
+// data, and a wave arena reset when a wave is cleared for data that lives
+// through the shop. If a frame or wave needs more than the block holds the
+// extra comes from overflow blocks, and the next reset() grows the main block
+// to the high-water mark so the steady state stops touching the heap.
+class MemoryArena {
+public:
+    MemoryArena(size_t capacity, const char* name);
+    ~MemoryArena();
+
+    MemoryArena(const MemoryArena&) = delete;
+    MemoryArena& operator=(const MemoryArena&) = delete;
+
+    void* allocate(size_t size, size_t alignment = alignof(std::max_align_t));
+
+    template <typename T>
+    T* allocateArray(size_t count) {
+        return static_cast<T*>(allocate(count * sizeof(T), alignof(T)));
+    }
+
+    // printf into arena memory; the string lives until the next reset()
+    const char* format(const char* fmt, ...)
+#if defined(__GNUC__)
+        __attribute__((format(printf, 2, 3)))
+#endif
+        ;
+
+    void reset();
+
+    size_t getUsed() const { return used + overflowUsed; }
+    size_t getCapacity() const { return capacity; }
+    size_t getHighWater() const { return highWater; }
+    const char* getName() const { return name; }
+
+private:
+    const char* name;
+    std::unique_ptr<unsigned char[]> block;
+    size_t capacity;
+    size_t used;
+    size_t highWater;
+
+    std::vector<std::unique_ptr<unsigned char[]>> overflow;
+    size_t overflowUsed;
+};
+
+// Standard allocator adapter so containers can live in an arena:
+//     ArenaVector<int> scratch{ArenaAllocator<int>(frameArena)};
+// deallocate() is a no-op; memory comes back when the arena resets.
+template <typename T>
+class ArenaAllocator {
+public:
+    using value_type = T;
+
+    explicit ArenaAllocator(MemoryArena& owner) : arena(&owner) {}
+    template <typename U>
+    ArenaAllocator(const ArenaAllocator<U>& other) : arena(other.arena) {}
+
+    T* allocate(size_t count) { return arena->allocateArray<T>(count); }
+    void deallocate(T*, size_t) {}
+
+    template <typename U>
+    bool operator==(const ArenaAllocator<U>& other) const { return arena == other.arena; }
+    template <typename U>
+    bool operator!=(const ArenaAllocator<U>& other) const { return arena != other.arena; }
+
+    MemoryArena* arena;
+};
+
+template <typename T>
+using ArenaVector = std::vector<T, ArenaAllocator<T>>;
@@ -1,12 +1,12 @@
 #include "Menu.h"
+#include "TextRenderer.h"
 #include <iostream>
 #include <cstdio>
 
 Menu::Menu() : active(false), canContinue(false), optionSelected(false), 
                currentOption(MenuOption::NEW_GAME),
                upKeyPressed(false), downKeyPressed(false), 
-               enterKeyPressed(false), escKeyPressed(false), lastMousePressed(false),
-               titleFont(nullptr), menuFont(nullptr) {
+               enterKeyPressed(false), escKeyPressed(false), lastMousePressed(false) {
     
     // Initialize colors
     titleColor = {255, 255, 255, 255};    // White
@@ -21,19 +21,11 @@ Menu::Menu() : active(false), canContinue(false), optionSelected(false),
 }
 
 Menu::~Menu() {
-    if (titleFont) {
-        TTF_CloseFont(titleFont);
-        titleFont = nullptr;
-    }
-    if (menuFont) {
-        TTF_CloseFont(menuFont);
-        menuFont = nullptr;
-    }
 }
 
 void Menu::loadAssets(SDL_Renderer* renderer) {
     // Try to load fonts in order of preference
-    const char* fontPaths[] = {
+    std::vector<std::string> fontPaths = {
         "assets/fonts/default.ttf",
         "/System/Library/Fonts/Arial.ttf",  // macOS system font
         "/System/Library/Fonts/Helvetica.ttc",  // macOS system font
@@ -42,29 +34,12 @@ void Menu::loadAssets(SDL_Renderer* renderer) {
         "C:/Windows/Fonts/consola.ttf"
     };
     
-    titleFont = nullptr;
-    menuFont = nullptr;
+    // Stream the title and menu sizes in ahead of everything else so the menu
+    // can show right away; until they land it draws with the fallback text.
+    // The hint line size is baked on first use.
+    font.begin(renderer, fontPaths, {48, 32}, AssetPriority::HIGH);
     
-    for (const char* fontPath : fontPaths) {
-        if (!titleFont) {
-            titleFont = TTF_OpenFont(fontPath, 48);
-            if (titleFont) {
-                std::cout << "Menu: Loaded title font from " << fontPath << std::endl;
-            }
-        }
-        if (!menuFont) {
-            menuFont = TTF_OpenFont(fontPath, 32);
-            if (menuFont) {
-                std::cout << "Menu: Loaded menu font from " << fontPath << std::endl;
-            }
-        }
-        
-        if (titleFont && menuFont) {
-            break;
-        }
-    }
-    
-    if (!titleFont || !menuFont) {
+    if (!hasFont()) {
         std::cout << "Menu: Using fallback text rendering (no TTF fonts available)" << std::endl;
     }
 }
@@ -192,6 +167,14 @@ void Menu::render(SDL_Renderer* renderer, int windowWidth, int windowHeight) {
         return;
     }
     
+    if (font.update()) {
+        if (hasFont()) {
+            std::cout << "Menu: Loaded font from " << font.getPath() << std::endl;
+        } else {
+            std::cout << "Menu: Using fallback text rendering (no TTF font could be loaded)" << std::endl;
+        }
+    }
+    
     // Draw semi-transparent background overlay
     SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
     SDL_SetRenderDrawColor(renderer, 0, 0, 0, 180);
@@ -202,7 +185,7 @@ void Menu::render(SDL_Renderer* renderer, int windowWidth, int windowHeight) {
     int centerX = windowWidth / 2;
     
     // Render title
-    if (titleFont) {
+    if (hasFont()) {
         renderText(renderer, "POTATO GAME", centerX - 150, titleY, titleColor, 48);
     } else {
         renderFallbackText(renderer, "POTATO GAME", centerX - 100, titleY, false);
@@ -228,7 +211,7 @@ void Menu::render(SDL_Renderer* renderer, int windowWidth, int windowHeight) {
             SDL_RenderDrawRect(renderer, &highlightRect);
         }
         
-        if (menuFont) {
+        if (hasFont()) {
             renderText(renderer, "CONTINUE", centerX - 60, yPos, color, 32);
         } else {
             renderFallbackText(renderer, "CONTINUE", centerX - 60, yPos, selected);
@@ -252,7 +235,7 @@ void Menu::render(SDL_Renderer* renderer, int windowWidth, int windowHeight) {
             SDL_RenderDrawRect(renderer, &highlightRect);
         }
         
-        if (menuFont) {
+        if (hasFont()) {
             renderText(renderer, "NEW GAME", centerX - 70, yPos, color, 32);
         } else {
             renderFallbackText(renderer, "NEW GAME", centerX - 70, yPos, selected);
@@ -276,7 +259,7 @@ void Menu::render(SDL_Renderer* renderer, int windowWidth, int windowHeight) {
             SDL_RenderDrawRect(renderer, &highlightRect);
         }
         
-        if (menuFont) {
+        if (hasFont()) {
             renderText(renderer, "EXIT", centerX - 30, yPos, color, 32);
         } else {
             renderFallbackText(renderer, "EXIT", centerX - 30, yPos, selected);
@@ -284,7 +267,7 @@ void Menu::render(SDL_Renderer* renderer, int windowWidth, int windowHeight) {
     }
     
     // Instructions at bottom
-    if (menuFont) {
+    if (hasFont()) {
         renderText(renderer, "Use ARROW KEYS and ENTER to navigate", 
                   centerX - 200, windowHeight - 100, normalColor, 16);
         if (canContinue) {
@@ -327,33 +310,9 @@ void Menu::activateCurrentOption() {
 
 void Menu::renderText(SDL_Renderer* renderer, const char* text, int x, int y, 
                      SDL_Color color, int fontSize) {
-    TTF_Font* font = (fontSize > 40) ? titleFont : menuFont;
-    if (!font) {
+    if (!TextRenderer::draw(renderer, font.getPath(), fontSize, text, x, y, color)) {
         renderFallbackText(renderer, text, x, y, false);
-        return;
     }
-    
-    SDL_Surface* textSurface = TTF_RenderText_Solid(font, text, color);
-    if (!textSurface) {
-        renderFallbackText(renderer, text, x, y, false);
-        return;
-    }
-    
-    SDL_Texture* textTexture = SDL_CreateTextureFromSurface(renderer, textSurface);
-    if (!textTexture) {
-        SDL_FreeSurface(textSurface);
-        renderFallbackText(renderer, text, x, y, false);
-        return;
-    }
-    
-    int textWidth = textSurface->w;
-    int textHeight = textSurface->h;
-    SDL_FreeSurface(textSurface);
-    
-    SDL_Rect destRect = {x, y, textWidth, textHeight};
-    SDL_RenderCopy(renderer, textTexture, nullptr, &destRect);
-    
-    SDL_DestroyTexture(textTexture);
 }
 
 void Menu::renderFallbackText(SDL_Renderer* renderer, const char* text, int x, int y, bool selected) {
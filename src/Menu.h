@@ -1,6 +1,7 @@
 #pragma once
 #include <SDL2/SDL.h>
-#include <SDL2/SDL_ttf.h>
+#include <string>
+#include "TextRenderer.h"
 
 class Game;
 
@@ -57,9 +58,9 @@ private:
     
     // Note: ESC cooldown is managed by Game class globally
     
-    // TTF Font
-    TTF_Font* titleFont;
-    TTF_Font* menuFont;
+    // TTF font file; glyph atlases per size are owned by TextRenderer
+    FontChooser font;
+    bool hasFont() const { return !font.getPath().empty(); }
     
     // Colors
     SDL_Color titleColor;
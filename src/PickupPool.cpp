@@ -0,0 +1,175 @@
+#include "PickupPool.h"
+#include "VectorMath.h"
+#include <cmath>
+#include <iostream>
+#include <random>
+
+PickupPool::PickupPool()
+    : count(0), materialCount(0),
+      positionX(CAPACITY), positionY(CAPACITY), lifetime(CAPACITY), bobPhase(CAPACITY),
+      experienceValue(CAPACITY), materialValue(CAPACITY), kind(CAPACITY), state(CAPACITY),
+      distanceSq(CAPACITY) {
+}
+
+int PickupPool::spawn(PickupKind pickupKind, Vector2 pos, int expValue, int matValue, float phase) {
+    if (count >= CAPACITY) {
+        static bool warned = false;
+        if (!warned) {
+            std::cout << "Pickup pool full (" << CAPACITY << "), dropping new pickups" << std::endl;
+            warned = true;
+        }
+        return -1;
+    }
+
+    int index = count++;
+    positionX[index] = pos.x;
+    positionY[index] = pos.y;
+    lifetime[index] = 0.0f;
+    bobPhase[index] = phase;
+    experienceValue[index] = expValue;
+    materialValue[index] = matValue;
+    kind[index] = pickupKind;
+    state[index] = ALIVE;
+    if (pickupKind == PickupKind::MATERIAL) {
+        materialCount++;
+    }
+    return index;
+}
+
+int PickupPool::spawnExperience(Vector2 pos, int expValue) {
+    return spawn(PickupKind::EXPERIENCE, pos, expValue, 0, 0.0f);
+}
+
+int PickupPool::spawnMaterial(Vector2 pos, int matValue, int expValue) {
+    // Random bob offset so materials don't all bob in sync
+    static std::random_device rd;
+    static std::mt19937 gen(rd());
+    std::uniform_real_distribution<float> dist(0, 2 * M_PI);
+    return spawn(PickupKind::MATERIAL, pos, expValue, matValue, dist(gen));
+}
+
+void PickupPool::update(float deltaTime, int begin, int end) {
+    for (int i = begin; i < end; i++) {
+        bool isMaterial = kind[i] == PickupKind::MATERIAL;
+        lifetime[i] += deltaTime;
+        bobPhase[i] += (isMaterial ? MATERIAL_BOB_SPEED : EXPERIENCE_BOB_SPEED) * deltaTime;
+
+        float maxLifetime = isMaterial ? MATERIAL_LIFETIME : EXPERIENCE_LIFETIME;
+        if (state[i] == ALIVE && lifetime[i] >= maxLifetime) {
+            state[i] = EXPIRED;
+        }
+    }
+}
+
+PickupTotals PickupPool::collectInRange(Vector2 center, float range) {
+    PickupTotals totals;
+    float rangeSq = range * range;
+    VectorMath::distanceSquared(positionX.data(), positionY.data(), center, distanceSq.data(), count);
+
+    for (int i = 0; i < count; i++) {
+        if (state[i] != ALIVE || distanceSq[i] > rangeSq) continue;
+
+        state[i] = COLLECTED;
+        totals.experience += experienceValue[i];
+        if (kind[i] == PickupKind::MATERIAL) {
+            totals.materials += materialValue[i];
+            totals.materialDrops++;
+        } else {
+            totals.experienceOrbs++;
+        }
+    }
+    return totals;
+}
+
+void PickupPool::moveSlot(int from, int to) {
+    positionX[to] = positionX[from];
+    positionY[to] = positionY[from];
+    lifetime[to] = lifetime[from];
+    bobPhase[to] = bobPhase[from];
+    experienceValue[to] = experienceValue[from];
+    materialValue[to] = materialValue[from];
+    kind[to] = kind[from];
+    state[to] = state[from];
+}
+
+int PickupPool::compact() {
+    int expiredMaterialValue = 0;
+    int i = 0;
+    while (i < count) {
+        if (state[i] == ALIVE) {
+            i++;
+            continue;
+        }
+
+        if (kind[i] == PickupKind::MATERIAL) {
+            materialCount--;
+            if (state[i] == EXPIRED) {
+                expiredMaterialValue += materialValue[i];
+            }
+        }
+
+        // Fill the hole with the last pickup; slot i is re-checked next pass
+        count--;
+        if (i != count) {
+            moveSlot(count, i);
+        }
+    }
+    return expiredMaterialValue;
+}
+
+PickupTotals PickupPool::drain() {
+    PickupTotals totals;
+    for (int i = 0; i < count; i++) {
+        if (state[i] != ALIVE) continue;
+
+        totals.experience += experienceValue[i];
+        if (kind[i] == PickupKind::MATERIAL) {
+            totals.materials += materialValue[i];
+            totals.materialDrops++;
+        } else {
+            totals.experienceOrbs++;
+        }
+    }
+    clear();
+    return totals;
+}
+
+void PickupPool::clear() {
+    count = 0;
+    materialCount = 0;
+}
+
+void PickupPool::render(RenderQueue& queue) const {
+    for (int i = 0; i < count; i++) {
+        if (state[i] != ALIVE) continue;
+
+        if (kind[i] == PickupKind::EXPERIENCE) {
+            // Glowing orb with a bright center, fading over the last 20% of its life
+            float fadeRatio = 1.0f;
+            if (lifetime[i] > EXPERIENCE_LIFETIME * 0.8f) {
+                fadeRatio = 1.0f - ((lifetime[i] - EXPERIENCE_LIFETIME * 0.8f) / (EXPERIENCE_LIFETIME * 0.2f));
+            }
+
+            Uint8 alpha = (Uint8)(255 * fadeRatio);
+            int centerX = (int)positionX[i];
+            int centerY = (int)(positionY[i] + sin(bobPhase[i]) * 2.0f);
+            int r = (int)EXPERIENCE_RADIUS;
+
+            queue.submitCircle(RenderLayer::PICKUPS, centerX, centerY, r, {150, 255, 150, 255}, 2, alpha, 0);
+            queue.submitCircle(RenderLayer::PICKUPS, centerX, centerY, r / 2, {255, 255, 255, 255}, 0, alpha, 1);
+        } else {
+            // Green blob (materials in Brotato are green) with a lighter green center
+            int centerX = (int)positionX[i];
+            int centerY = (int)positionY[i] + (int)(sin(bobPhase[i]) * 3.0f);
+            int r = (int)MATERIAL_RADIUS;
+
+            queue.submitCircle(RenderLayer::PICKUPS, centerX, centerY, r, {0, 200, 0, 255}, 0, 255, 0);
+            queue.submitCircle(RenderLayer::PICKUPS, centerX, centerY, r / 2, {100, 255, 100, 255}, 0, 255, 1);
+
+            // Visual indicator that the material will disappear soon
+            if (lifetime[i] > MATERIAL_LIFETIME * 0.8f) {
+                queue.submitRing(RenderLayer::PICKUPS, centerX, centerY, r + 2, {255, 255, 0, 100}, 18, 255, 2);
+            }
+        }
+    }
+}
@@ -0,0 +1,80 @@
+#pragma once
+#include <SDL2/SDL.h>
+#include <vector>
+#include "Vector2.h"
+#include "RenderQueue.h"
+
+enum class PickupKind : Uint8 {
+    EXPERIENCE, // Green orb, experience only
+    MATERIAL    // Brotato-style material: experience plus shop currency
+};
+
+// Sums handed back by batch collection and wave-end draining
+struct PickupTotals {
+    int experience = 0;
+    int materials = 0;
+    int experienceOrbs = 0; // Number of EXPERIENCE pickups
+    int materialDrops = 0;  // Number of MATERIAL pickups
+};
+
+// Experience orbs and materials in one structure-of-arrays pool.
+// Slots [0, size()) are packed and allocated once up front, so kills and
+// drops never allocate; update, collection and compaction are linear scans.
+class PickupPool {
+public:
+    static const int CAPACITY = 4096;
+
+    PickupPool();
+
+    // Return the new pickup's index, or -1 when the pool is full
+    int spawnExperience(Vector2 pos, int expValue = 1);
+    int spawnMaterial(Vector2 pos, int materialValue = 1, int expValue = 1);
+
+    // Advances lifetime and bob phase; pickups past their lifetime expire
+    void update(float deltaTime) { update(deltaTime, 0, count); }
+    // Same for slots [begin, end) only; disjoint ranges can run on different threads
+    void update(float deltaTime, int begin, int end);
+    // Collects every live pickup within `range` of `center`
+    PickupTotals collectInRange(Vector2 center, float range);
+    // Swap-removes collected and expired pickups. Returns the material value
+    // of materials that expired uncollected, which go to the material bag.
+    int compact();
+    // Totals of everything still on the ground, then empties the pool
+    PickupTotals drain();
+    void clear();
+
+    void render(RenderQueue& queue) const;
+
+    int size() const { return count; }
+    int getMaterialCount() const { return materialCount; }
+
+private:
+    enum State : Uint8 {
+        ALIVE,
+        COLLECTED,
+        EXPIRED
+    };
+
+    int spawn(PickupKind kind, Vector2 pos, int expValue, int materialValue, float bobPhase);
+    void moveSlot(int from, int to);
+
+    int count;
+    int materialCount; // Live MATERIAL pickups, for the on-map cap
+
+    std::vector<float> positionX;
+    std::vector<float> positionY;
+    std::vector<float> lifetime;
+    std::vector<float> bobPhase;
+    std::vector<int> experienceValue;
+    std::vector<int> materialValue;
+    std::vector<PickupKind> kind;
+    std::vector<Uint8> state;
+    std::vector<float> distanceSq; // Scratch for collectInRange
+
+    static constexpr float EXPERIENCE_RADIUS = 8.0f;
+    static constexpr float EXPERIENCE_LIFETIME = 30.0f;
+    static constexpr float EXPERIENCE_BOB_SPEED = 3.0f;
+    static constexpr float MATERIAL_RADIUS = 6.0f;
+    static constexpr float MATERIAL_LIFETIME = 60.0f;
+    static constexpr float MATERIAL_BOB_SPEED = 2.0f;
+};
@@ -1,12 +1,11 @@
 #include "Player.h"
 #include <cmath>
 #include <iostream>
-#include <SDL2/SDL_image.h>
 
 Player::Player(float x, float y) 
-    : position(x, y), velocity(0, 0), shootDirection(1, 0), 
+    : position(x, y), previousPosition(x, y), velocity(0, 0), shootDirection(1, 0), 
       radius(20), health(100), shootCooldown(0.15f), timeSinceLastShot(0),
-      experience(0), level(1), healthRegenTimer(0), playerTexture(nullptr) {
+      experience(0), level(1), healthRegenTimer(0) {
     // Initialize health to match max health
     health = stats.maxHealth;
     
@@ -17,21 +16,9 @@ Player::Player(float x, float y)
 }
 
 void Player::initialize(SDL_Renderer* renderer) {
-    // Load brick character sprite
-    SDL_Surface* surface = IMG_Load("assets/character/brick.png");
-    if (!surface) {
-        std::cout << "Failed to load brick.png! SDL_image Error: " << IMG_GetError() << std::endl;
-        return;
-    }
-    
-    playerTexture = SDL_CreateTextureFromSurface(renderer, surface);
-    SDL_FreeSurface(surface);
-    
-    if (!playerTexture) {
-        std::cout << "Failed to create texture from brick.png! SDL Error: " << SDL_GetError() << std::endl;
-    } else {
-        std::cout << "Successfully loaded brick character sprite!" << std::endl;
-    }
+    // Load brick character sprite (shared, so starting a new game doesn't reload it).
+    // It streams in; until then render() draws the fallback circle.
+    playerTexture = SpriteAtlas::get(renderer, "assets/character/brick.png");
 }
 
 void Player::update(float deltaTime) {
@@ -42,8 +29,6 @@ void Player::update(float deltaTime) {
     if (position.y < radius) position.y = radius;
     if (position.y > 1080 - radius) position.y = 1080 - radius;
     
-    velocity = Vector2(0, 0);
-    
     timeSinceLastShot += deltaTime;
     
     // Health regeneration
@@ -57,19 +42,16 @@ void Player::update(float deltaTime) {
     }
 }
 
-void Player::render(SDL_Renderer* renderer) {
-    int centerX = (int)position.x;
-    int centerY = (int)position.y;
+void Player::render(RenderQueue& queue) {
+    Vector2 renderPos = queue.interpolate(previousPosition, position);
+    int centerX = (int)renderPos.x;
+    int centerY = (int)renderPos.y;
     
-    if (playerTexture) {
-        // Get texture dimensions
-        int textureWidth, textureHeight;
-        SDL_QueryTexture(playerTexture, nullptr, nullptr, &textureWidth, &textureHeight);
-        
+    if (playerTexture.texture()) {
         // Scale the brick sprite appropriately
         float scale = 0.8f; // Adjust size as needed
-        int scaledWidth = (int)(textureWidth * scale);
-        int scaledHeight = (int)(textureHeight * scale);
+        int scaledWidth = (int)(playerTexture.width() * scale);
+        int scaledHeight = (int)(playerTexture.height() * scale);
         
         // Create destination rectangle centered on player position
         SDL_Rect destRect = {
@@ -80,19 +62,10 @@ void Player::render(SDL_Renderer* renderer) {
         };
         
         // Render the brick sprite
-        SDL_RenderCopy(renderer, playerTexture, nullptr, &destRect);
+        queue.submitSprite(RenderLayer::PLAYER, playerTexture, destRect);
     } else {
         // Fallback to orange circle if texture fails to load
-        SDL_SetRenderDrawColor(renderer, 255, 200, 100, 255);
-        int r = (int)radius;
-        
-        for (int x = -r; x <= r; x++) {
-            for (int y = -r; y <= r; y++) {
-                if (x*x + y*y <= r*r) {
-                    SDL_RenderDrawPoint(renderer, centerX + x, centerY + y);
-                }
-            }
-        }
+        queue.submitCircle(RenderLayer::PLAYER, centerX, centerY, (int)radius, {255, 200, 100, 255});
     }
     
     // Remove the orange direction line - user doesn't want it
@@ -102,19 +75,16 @@ void Player::render(SDL_Renderer* renderer) {
     //                   centerY + shootDirection.y * 30);
     
     // Draw pickup range indicator (faint circle)
-    SDL_SetRenderDrawColor(renderer, 100, 255, 100, 30);
-    int pickupR = (int)stats.pickupRange;
-    for (int angle = 0; angle < 360; angle += 10) {
-        float rad = angle * M_PI / 180.0f;
-        int x1 = centerX + cos(rad) * pickupR;
-        int y1 = centerY + sin(rad) * pickupR;
-        SDL_RenderDrawPoint(renderer, x1, y1);
-    }
+    queue.submitRing(RenderLayer::PLAYER, centerX, centerY, (int)stats.pickupRange, {100, 255, 100, 30}, 36, 255, 1);
 }
 
 void Player::handleInput(const Uint8* keyState) {
     float currentSpeed = stats.moveSpeed;
     
+    // Input is sampled once per frame but may drive several ticks, so the
+    // velocity is rebuilt here instead of being cleared after each update
+    velocity = Vector2(0, 0);
+    
     if (keyState[SDL_SCANCODE_W] || keyState[SDL_SCANCODE_UP]) {
         velocity.y = -currentSpeed;
     }
@@ -225,7 +195,7 @@ void Player::initializeWeapons(SDL_Renderer* renderer) {
     }
 }
 
-void Player::updateWeapons(float deltaTime, std::vector<std::unique_ptr<Bullet>>& bullets) {
+void Player::updateWeapons(float deltaTime, BulletPool& bullets) {
     if (weapons.empty()) return;
     
     // Calculate circular positioning for multiple weapons (same as renderWeapons)
@@ -244,24 +214,25 @@ void Player::updateWeapons(float deltaTime, std::vector<std::unique_ptr<Bullet>>
     }
 }
 
-void Player::renderWeapons(SDL_Renderer* renderer) {
+void Player::renderWeapons(RenderQueue& queue) {
     if (weapons.empty()) return;
     
     // Calculate circular positioning for multiple weapons
     int numWeapons = weapons.size();
     float radius = 50.0f; // Increased distance from player center
+    Vector2 renderPos = queue.interpolate(previousPosition, position);
     
     for (int i = 0; i < numWeapons; i++) {
         // Calculate weapon position in circle around player (position only)
         float angleOffset = (2.0f * M_PI * i) / numWeapons;
         float positionAngle = angleOffset; // Just spread positions around circle
         Vector2 offsetDirection(cos(positionAngle), sin(positionAngle));
-        Vector2 weaponPos = position + offsetDirection * radius;
+        Vector2 weaponPos = renderPos + offsetDirection * radius;
         
         // All weapons point toward mouse (same direction)
         Vector2 weaponDirection = shootDirection;
         
         // Render weapon at calculated position but pointing at mouse
-        weapons[i]->render(renderer, weaponPos, weaponDirection);
+        weapons[i]->render(queue, weaponPos, weaponDirection);
     }
 }
\ No newline at end of file
@@ -4,6 +4,8 @@
 #include <memory>
 #include "Vector2.h"
 #include "Weapon.h"
+#include "SpriteAtlas.h"
+#include "RenderQueue.h"
 
 struct PlayerStats {
     // Brotato-like stats
@@ -31,8 +33,10 @@ public:
     // Initialize player with renderer for texture loading
     void initialize(SDL_Renderer* renderer);
     
+    // Remembers the position at the start of a tick for render interpolation
+    void beginTick() { previousPosition = position; }
     void update(float deltaTime);
-    void render(SDL_Renderer* renderer);
+    void render(RenderQueue& queue);
     void handleInput(const Uint8* keyState);
     void updateShootDirection(const Vector2& mousePosition);
     void gainExperience(int exp);
@@ -41,8 +45,8 @@ public:
     // Weapon management
     void addWeapon(std::unique_ptr<Weapon> weapon);
     void addWeapon(std::unique_ptr<Weapon> weapon, SDL_Renderer* renderer);
-    void updateWeapons(float deltaTime, std::vector<std::unique_ptr<Bullet>>& bullets);
-    void renderWeapons(SDL_Renderer* renderer);
+    void updateWeapons(float deltaTime, BulletPool& bullets);
+    void renderWeapons(RenderQueue& queue);
     void initializeWeapons(SDL_Renderer* renderer);
     
     Vector2 getPosition() const { return position; }
@@ -63,6 +67,7 @@ public:
     void gainMaterials(int amount) { stats.materials += amount; }
     
     // Weapon getters
+    static const int MAX_WEAPONS = 6;
     int getWeaponCount() const { return weapons.size(); }
     const std::vector<std::unique_ptr<Weapon>>& getWeapons() const { return weapons; }
     const Weapon* getWeapon(int index) const { 
@@ -74,6 +79,7 @@ public:
     
 private:
     Vector2 position;
+    Vector2 previousPosition;
     Vector2 velocity;
     Vector2 shootDirection;
     float radius;
@@ -89,8 +95,7 @@ private:
     
     // Weapon inventory (max 6 weapons like Brotato)
     std::vector<std::unique_ptr<Weapon>> weapons;
-    static const int MAX_WEAPONS = 6;
     
     // Player sprite
-    SDL_Texture* playerTexture;
+    Sprite playerTexture;
 };
\ No newline at end of file
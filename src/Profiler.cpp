@@ -0,0 +1,160 @@
+#include "Profiler.h"
+#include <algorithm>
+
+std::atomic<bool> Profiler::requestedEnabled{false};
+thread_local Profiler::Track* Profiler::currentTrack = nullptr;
+Profiler::Track Profiler::tracks[static_cast<int>(ProfileTrack::COUNT)];
+
+namespace {
+// Root zone of each track; the overlay shows it as the track's heading
+const char* const ROOT_ZONE_NAMES[] = {"Frame", "Simulation"};
+}
+
+void Profiler::beginFrame(ProfileTrack track) {
+    Track& current = tracks[static_cast<int>(track)];
+    currentTrack = &current;
+    current.enabled = requestedEnabled;
+    if (!current.enabled) return;
+
+    current.stack.clear();
+    current.startTimes.clear();
+    for (auto& zone : current.zones) {
+        zone.frameTicks = 0;
+        zone.frameCalls = 0;
+    }
+
+    // Whole frame is the implicit root zone
+    beginZone(ROOT_ZONE_NAMES[static_cast<int>(track)]);
+}
+
+void Profiler::endFrame() {
+    if (!isEnabled()) return;
+    Track& track = *currentTrack;
+
+    // Close anything left open (early returns are covered by RAII, this is the root)
+    while (!track.stack.empty()) {
+        endZone();
+    }
+
+    double frequency = static_cast<double>(SDL_GetPerformanceFrequency());
+    int slot = track.historyIndex;
+    track.historyIndex = (track.historyIndex + 1) % HISTORY_FRAMES;
+
+    for (auto& zone : track.zones) {
+        float ms = static_cast<float>(static_cast<double>(zone.frameTicks) * 1000.0 / frequency);
+        zone.history[slot] = ms;
+        zone.lastMs = ms;
+        zone.lastCalls = zone.frameCalls;
+
+        float total = 0.0f;
+        float maxMs = 0.0f;
+        for (int i = 0; i < HISTORY_FRAMES; i++) {
+            total += zone.history[i];
+            maxMs = std::max(maxMs, zone.history[i]);
+        }
+        zone.averageMs = total / HISTORY_FRAMES;
+        zone.maxMs = maxMs;
+    }
+
+    track.frameHistory[slot] = track.zones.empty() ? 0.0f : track.zones[0].lastMs;
+
+    // Assignment reuses the copy's storage once the zone set is stable
+    std::lock_guard<std::mutex> lock(track.publishedMutex);
+    track.published = track.zones;
+}
+
+int Profiler::findOrAddZone(Track& track, const char* name, int parent) {
+    std::vector<Zone>& zones = track.zones;
+    for (size_t i = 0; i < zones.size(); i++) {
+        if (zones[i].name == name && zones[i].parent == parent) {
+            return static_cast<int>(i);
+        }
+    }
+
+    Zone zone = {};
+    zone.name = name;
+    zone.parent = parent;
+    zone.depth = parent < 0 ? 0 : zones[parent].depth + 1;
+
+    // Keep children right after their parent's existing subtree so the
+    // table reads depth-first
+    size_t insertAt = zones.size();
+    if (parent >= 0) {
+        insertAt = parent + 1;
+        while (insertAt < zones.size() && zones[insertAt].depth > zones[parent].depth) {
+            insertAt++;
+        }
+    }
+
+    if (insertAt == zones.size()) {
+        zones.push_back(zone);
+        return static_cast<int>(zones.size() - 1);
+    }
+
+    // Inserting shifts indices: fix up parents and the open-zone stack
+    int index = static_cast<int>(insertAt);
+    zones.insert(zones.begin() + index, zone);
+    for (auto& other : zones) {
+        if (&other != &zones[index] && other.parent >= index) {
+            other.parent++;
+        }
+    }
+    for (auto& open : track.stack) {
+        if (open >= index) {
+            open++;
+        }
+    }
+    return index;
+}
+
+void Profiler::beginZone(const char* name) {
+    Track& track = *currentTrack;
+    int parent = track.stack.empty() ? -1 : track.stack.back();
+    int index = findOrAddZone(track, name, parent);
+    track.stack.push_back(index);
+    track.startTimes.push_back(SDL_GetPerformanceCounter());
+}
+
+void Profiler::endZone() {
+    Track& track = *currentTrack;
+    if (track.stack.empty()) return;
+
+    Uint64 now = SDL_GetPerformanceCounter();
+    Zone& zone = track.zones[track.stack.back()];
+    zone.frameTicks += now - track.startTimes.back();
+    zone.frameCalls++;
+
+    track.stack.pop_back();
+    track.startTimes.pop_back();
+}
+
+void Profiler::copyZones(ProfileTrack track, std::vector<Zone>& out) {
+    Track& source = tracks[static_cast<int>(track)];
+    std::lock_guard<std::mutex> lock(source.publishedMutex);
+    out = source.published;
+}
+
+const float* Profiler::getFrameHistory() {
+    return tracks[static_cast<int>(ProfileTrack::MAIN)].frameHistory;
+}
+
+int Profiler::getFrameHistoryIndex() {
+    return tracks[static_cast<int>(ProfileTrack::MAIN)].historyIndex;
+}
+
+float Profiler::getFrameMaxMs() {
+    const float* history = getFrameHistory();
+    return *std::max_element(history, history + HISTORY_FRAMES);
+}
+
+void Profiler::reset() {
+    for (Track& track : tracks) {
+        track.zones.clear();
+        track.stack.clear();
+        track.startTimes.clear();
+        std::fill(track.frameHistory, track.frameHistory + HISTORY_FRAMES, 0.0f);
+        track.historyIndex = 0;
+        std::lock_guard<std::mutex> lock(track.publishedMutex);
+        track.published.clear();
+    }
+}
@@ -0,0 +1,108 @@
+#pragma once
+#include <SDL2/SDL.h>
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+// Hierarchical frame profiler built from RAII zones:
+//
+//     void Game::checkCollisions() {
+//         PROFILE_ZONE("checkCollisions");
+//         ...
+//     }
+//
+// Zones nest by call structure; each (parent, name) pair becomes one node
+// with per-frame time, call count, and a rolling average and max over the
+// last HISTORY_FRAMES frames. While disabled a zone costs one branch on a
+// thread-local pointer, so the macros stay in release builds.
+//
+// Each thread that profiles itself has its own track: the main thread's
+// render frames and the simulation thread's steps. A thread records zones
+// between its beginFrame()/endFrame() calls; zones opened on threads without
+// a track (job workers) are skipped.
+enum class ProfileTrack {
+    MAIN,
+    SIMULATION,
+    COUNT
+};
+
+class Profiler {
+public:
+    static const int HISTORY_FRAMES = 120;
+
+    struct Zone {
+        const char* name;  // String literal from PROFILE_ZONE, compared by pointer
+        int parent;        // Index into the track's zones, -1 for the root
+        int depth;
+        Uint64 frameTicks; // Accumulated this frame
+        int frameCalls;
+        float lastMs;
+        float averageMs;
+        float maxMs;
+        int lastCalls;
+        float history[HISTORY_FRAMES];
+    };
+
+    // Takes effect at each track's next beginFrame() so zones never straddle a toggle
+    static void setEnabled(bool enable) { requestedEnabled = enable; }
+    // True while the calling thread's track is profiling
+    static bool isEnabled() { return currentTrack && currentTrack->enabled; }
+
+    // Binds the calling thread to `track` and opens its root zone
+    static void beginFrame(ProfileTrack track = ProfileTrack::MAIN);
+    static void endFrame();
+
+    static void beginZone(const char* name);
+    static void endZone();
+
+    // The track's zones as of its last endFrame(), in first-seen order (also
+    // depth-first for a stable frame). Safe from any thread.
+    static void copyZones(ProfileTrack track, std::vector<Zone>& out);
+    // Main track's total frame time per frame, oldest first is at
+    // getFrameHistoryIndex(). Main thread only.
+    static const float* getFrameHistory();
+    static int getFrameHistoryIndex();
+    static float getFrameMaxMs();
+
+    // Clears every track; only while no thread is profiling
+    static void reset();
+
+private:
+    struct Track {
+        bool enabled = false;
+        std::vector<Zone> zones;
+        std::vector<int> stack;
+        std::vector<Uint64> startTimes;
+        float frameHistory[HISTORY_FRAMES] = {};
+        int historyIndex = 0;
+
+        std::mutex publishedMutex;
+        std::vector<Zone> published; // Copy of zones for readers on other threads
+    };
+
+    static int findOrAddZone(Track& track, const char* name, int parent);
+
+    static std::atomic<bool> requestedEnabled;
+    static thread_local Track* currentTrack;
+    static Track tracks[static_cast<int>(ProfileTrack::COUNT)];
+};
+
+class ProfileScope {
+public:
+    explicit ProfileScope(const char* name) : active(Profiler::isEnabled()) {
+        if (active) Profiler::beginZone(name);
+    }
+    ~ProfileScope() {
+        if (active) Profiler::endZone();
+    }
+
+    ProfileScope(const ProfileScope&) = delete;
+    ProfileScope& operator=(const ProfileScope&) = delete;
+
+private:
+    bool active;
+};
+
+#define PROFILE_CONCAT_INNER(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_INNER(a, b)
+#define PROFILE_ZONE(name) ProfileScope PROFILE_CONCAT(profileScope_, __LINE__)(name)
@@ -0,0 +1,93 @@
+#include "ProjectileBatch.h"
+#include "CircleCache.h"
+
+ProjectileBatch::ProjectileBatch() : bulletCount(0), drawCalls(0) {
+}
+
+ProjectileBatch::Group& ProjectileBatch::getGroup(int radius) {
+    // Only a handful of radii exist, a linear search beats a map here
+    for (auto& group : groups) {
+        if (group.radius == radius) {
+            return group;
+        }
+    }
+    groups.push_back(Group{radius, {}, {}});
+    return groups.back();
+}
+
+void ProjectileBatch::appendQuad(Group& group, float centerX, float centerY, SDL_Color color) {
+    // Same footprint as CircleCache::drawFilled: (2r+1)^2 pixels around the snapped center
+    float r = static_cast<float>(group.radius);
+    float left = centerX - r;
+    float top = centerY - r;
+    float right = centerX + r + 1.0f;
+    float bottom = centerY + r + 1.0f;
+
+    int base = static_cast<int>(group.vertices.size());
+    group.vertices.push_back({{left, top}, color, {0.0f, 0.0f}});
+    group.vertices.push_back({{right, top}, color, {1.0f, 0.0f}});
+    group.vertices.push_back({{right, bottom}, color, {1.0f, 1.0f}});
+    group.vertices.push_back({{left, bottom}, color, {0.0f, 1.0f}});
+
+    group.indices.push_back(base);
+    group.indices.push_back(base + 1);
+    group.indices.push_back(base + 2);
+    group.indices.push_back(base);
+    group.indices.push_back(base + 2);
+    group.indices.push_back(base + 3);
+}
+
+void ProjectileBatch::capture(const BulletPool& bullets, std::vector<BulletSprite>& out) {
+    out.clear();
+    for (int i = 0; i < bullets.size(); i++) {
+        if (!bullets.isAlive(i)) continue;
+        out.push_back(BulletSprite{bullets.getPreviousPosition(i), bullets.getPosition(i), bullets.getColor(i),
+                                   static_cast<int>(bullets.getRadius(i))});
+    }
+}
+
+void ProjectileBatch::render(SDL_Renderer* renderer, const std::vector<BulletSprite>& bullets, float alpha) {
+    bulletCount = 0;
+    drawCalls = 0;
+
+    for (auto& group : groups) {
+        group.vertices.clear();
+        group.indices.clear();
+    }
+
+    // Gather all live bullets into per-texture vertex/index buffers
+    for (const BulletSprite& bullet : bullets) {
+        Group& group = getGroup(bullet.radius);
+        Vector2 pos = bullet.previous.lerp(bullet.current, alpha);
+        appendQuad(group, static_cast<float>(static_cast<int>(pos.x)),
+                   static_cast<float>(static_cast<int>(pos.y)), bullet.color);
+        bulletCount++;
+    }
+
+    SDL_Color white = {255, 255, 255, 255};
+    for (auto& group : groups) {
+        if (group.indices.empty()) continue;
+
+        SDL_Texture* texture = CircleCache::getTexture(renderer, CircleShape::FILLED, group.radius, white, 0);
+        if (texture) {
+            SDL_SetTextureAlphaMod(texture, 255);
+        }
+
+        int result = SDL_RenderGeometry(renderer, texture,
+                                        group.vertices.data(), static_cast<int>(group.vertices.size()),
+                                        group.indices.data(), static_cast<int>(group.indices.size()));
+        drawCalls++;
+
+        if (result != 0) {
+            // Renderer without geometry support: fall back to one copy per bullet
+            drawCalls--;
+            for (size_t v = 0; v < group.vertices.size(); v += 4) {
+                const SDL_Vertex& topLeft = group.vertices[v];
+                CircleCache::drawFilled(renderer, static_cast<int>(topLeft.position.x) + group.radius,
+                                        static_cast<int>(topLeft.position.y) + group.radius,
+                                        group.radius, topLeft.color);
+                drawCalls++;
+            }
+        }
+    }
+}
@@ -0,0 +1,48 @@
+#pragma once
+#include <SDL2/SDL.h>
+#include <vector>
+#include "BulletPool.h"
+
+// What a bullet looks like this tick, copied out of the BulletPool for a render snapshot
+struct BulletSprite {
+    Vector2 previous;
+    Vector2 current;
+    SDL_Color color;
+    int radius;
+};
+
+// Draws every live bullet with a handful of SDL_RenderGeometry calls.
+// Bullets are grouped by the circle texture their BulletType uses (one white
+// circle per radius from CircleCache); the BulletType color is carried per
+// vertex, so all bullet colors that share a radius go out in a single call.
+class ProjectileBatch {
+public:
+    ProjectileBatch();
+
+    // Copies every live bullet into `out` (cleared first); safe off the main thread
+    static void capture(const BulletPool& bullets, std::vector<BulletSprite>& out);
+
+    // `alpha` interpolates between each bullet's previous and current tick position
+    void render(SDL_Renderer* renderer, const std::vector<BulletSprite>& bullets, float alpha = 1.0f);
+
+    // Stats from the last render() call
+    int getBulletCount() const { return bulletCount; }
+    int getDrawCalls() const { return drawCalls; }
+    // Draw calls avoided compared to one SDL_RenderCopy per bullet
+    int getDrawCallsSaved() const { return bulletCount - drawCalls; }
+
+private:
+    struct Group {
+        int radius;
+        std::vector<SDL_Vertex> vertices;
+        std::vector<int> indices;
+    };
+
+    Group& getGroup(int radius);
+    void appendQuad(Group& group, float centerX, float centerY, SDL_Color color);
+
+    // Buffers are kept between frames so steady-state rendering doesn't allocate
+    std::vector<Group> groups;
+    int bulletCount;
+    int drawCalls;
+};
@@ -0,0 +1,303 @@
+#include "RenderQueue.h"
+#include "CircleCache.h"
+#include <algorithm>
+#include <cmath>
+
+namespace {
+
+Uint32 packColor(SDL_Color color) {
+    return (static_cast<Uint32>(color.r) << 24) | (static_cast<Uint32>(color.g) << 16) |
+           (static_cast<Uint32>(color.b) << 8) | static_cast<Uint32>(color.a);
+}
+
+bool sameColor(SDL_Color a, SDL_Color b) {
+    return packColor(a) == packColor(b);
+}
+
+bool commandLess(const RenderCommand& a, const RenderCommand& b) {
+    if (a.layer != b.layer) return a.layer < b.layer;
+    if (a.depth != b.depth) return a.depth < b.depth;
+    if (a.type != b.type) return a.type < b.type;
+    if (a.texture != b.texture) return std::less<SDL_Texture*>()(a.texture, b.texture);
+    if (a.type == RenderCommand::Type::CIRCLE) {
+        // One circle texture per (shape, radius, param)
+        if (a.circleShape != b.circleShape) return a.circleShape < b.circleShape;
+        if (a.circleRadius != b.circleRadius) return a.circleRadius < b.circleRadius;
+        if (a.circleParam != b.circleParam) return a.circleParam < b.circleParam;
+    }
+    // Sprites are tinted per vertex, only primitives need the color grouped
+    if (a.type != RenderCommand::Type::SPRITE && a.type != RenderCommand::Type::CIRCLE) {
+        Uint32 colorA = packColor(a.color);
+        Uint32 colorB = packColor(b.color);
+        if (colorA != colorB) return colorA < colorB;
+    }
+    return a.sequence < b.sequence;
+}
+
+} // namespace
+
+RenderQueue::RenderQueue()
+    : renderer(nullptr), nextSequence(0), motion(0.0f, 0.0f), drawAlpha(1.0f), currentColor{0, 0, 0, 0},
+      currentColorValid(false), drawCalls(0), stateChanges(0) {
+}
+
+RenderCommand& RenderQueue::push(RenderCommand::Type type, RenderLayer layer, int depth) {
+    commands.emplace_back();
+    RenderCommand& command = commands.back();
+    command.type = type;
+    command.layer = layer;
+    command.depth = static_cast<Sint16>(depth);
+    command.texture = nullptr;
+    command.source = {0, 0, 0, 0};
+    command.dest = {0, 0, 0, 0};
+    command.lineEnd = {0, 0};
+    command.angle = 0.0;
+    command.color = {255, 255, 255, 255};
+    command.circleShape = CircleShape::FILLED;
+    command.circleRadius = 0;
+    command.circleParam = 0;
+    command.motion = motion;
+    command.sequence = nextSequence++;
+    return command;
+}
+
+void RenderQueue::submitSprite(RenderLayer layer, const Sprite& sprite, const SDL_Rect& dest,
+                               double angle, SDL_Color tint, int depth) {
+    // Texture first: once it is non-null the page size region() reads is valid
+    SDL_Texture* texture = sprite.texture();
+    if (!texture) return;
+    submitTexture(layer, texture, sprite.region(), dest, angle, tint, depth);
+}
+
+void RenderQueue::submitTexture(RenderLayer layer, SDL_Texture* texture, const SDL_Rect& source,
+                                const SDL_Rect& dest, double angle, SDL_Color tint, int depth) {
+    if (!texture) return;
+    RenderCommand& command = push(RenderCommand::Type::SPRITE, layer, depth);
+    command.texture = texture;
+    command.source = source;
+    command.dest = dest;
+    command.angle = angle;
+    command.color = tint;
+}
+
+void RenderQueue::submitCircleSprite(RenderLayer layer, CircleShape shape, int radius, int param,
+                                     int centerX, int centerY, SDL_Color color, Uint8 alpha, int depth) {
+    if (radius < 0) radius = 0;
+    if (param < 0) param = 0;
+    int extent = CircleCache::getExtent(shape, radius, param);
+    int size = extent * 2 + 1;
+
+    // The texture is fetched (or rasterized) in draw(), on the thread that owns the renderer
+    RenderCommand& command = push(RenderCommand::Type::CIRCLE, layer, depth);
+    command.source = {0, 0, size, size};
+    command.dest = {centerX - extent, centerY - extent, size, size};
+    command.circleShape = shape;
+    command.circleRadius = static_cast<Sint16>(radius);
+    command.circleParam = static_cast<Sint16>(param);
+    // Same result as CircleCache's colored textures with an alpha mod
+    color.a = static_cast<Uint8>((color.a * alpha) / 255);
+    command.color = color;
+}
+
+void RenderQueue::submitCircle(RenderLayer layer, int centerX, int centerY, int radius, SDL_Color color,
+                               int glow, Uint8 alpha, int depth) {
+    submitCircleSprite(layer, CircleShape::FILLED, radius, glow, centerX, centerY, color, alpha, depth);
+}
+
+void RenderQueue::submitRing(RenderLayer layer, int centerX, int centerY, int radius, SDL_Color color,
+                             int dots, Uint8 alpha, int depth) {
+    submitCircleSprite(layer, CircleShape::RING, radius, dots, centerX, centerY, color, alpha, depth);
+}
+
+void RenderQueue::submitRect(RenderLayer layer, const SDL_Rect& rect, SDL_Color color, int depth) {
+    RenderCommand& command = push(RenderCommand::Type::FILL_RECT, layer, depth);
+    command.dest = rect;
+    command.color = color;
+}
+
+void RenderQueue::submitLine(RenderLayer layer, int x1, int y1, int x2, int y2, SDL_Color color, int depth) {
+    RenderCommand& command = push(RenderCommand::Type::LINE, layer, depth);
+    command.dest = {x1, y1, 0, 0};
+    command.lineEnd = {x2, y2};
+    command.color = color;
+}
+
+void RenderQueue::sort() {
+    std::sort(commands.begin(), commands.end(), commandLess);
+}
+
+void RenderQueue::clear() {
+    commands.clear();
+    nextSequence = 0;
+    motion = Vector2(0.0f, 0.0f);
+}
+
+SDL_Rect RenderQueue::place(const RenderCommand& command) const {
+    // Back along the tick's motion by the part of the tick not yet reached
+    float back = 1.0f - drawAlpha;
+    SDL_Rect dest = command.dest;
+    dest.x += static_cast<int>(std::lround(command.motion.x * back));
+    dest.y += static_cast<int>(std::lround(command.motion.y * back));
+    return dest;
+}
+
+SDL_Texture* RenderQueue::getTexture(const RenderCommand& command) const {
+    if (command.type != RenderCommand::Type::CIRCLE) return command.texture;
+    SDL_Color white = {255, 255, 255, 255};
+    return CircleCache::getTexture(renderer, command.circleShape, command.circleRadius, white, command.circleParam);
+}
+
+bool RenderQueue::sameTexture(const RenderCommand& a, const RenderCommand& b) {
+    if (a.type != b.type) return false;
+    if (a.type == RenderCommand::Type::SPRITE) return a.texture == b.texture;
+    return a.circleShape == b.circleShape && a.circleRadius == b.circleRadius && a.circleParam == b.circleParam;
+}
+
+void RenderQueue::draw(const std::vector<RenderCommand>& list, RenderLayer firstLayer, RenderLayer lastLayer,
+                       float alpha) {
+    if (list.empty() || !renderer) return;
+
+    // `list` is sorted by layer first
+    auto begin = std::partition_point(list.begin(), list.end(),
+                                      [&](const RenderCommand& command) { return command.layer < firstLayer; });
+    auto end = std::partition_point(begin, list.end(),
+                                    [&](const RenderCommand& command) { return command.layer <= lastLayer; });
+    const RenderCommand* commandsToDraw = list.data() + (begin - list.begin());
+    size_t count = static_cast<size_t>(end - begin);
+
+    drawAlpha = alpha;
+    currentColorValid = false;
+    size_t i = 0;
+    while (i < count) {
+        const RenderCommand& command = commandsToDraw[i];
+
+        if (command.type == RenderCommand::Type::SPRITE || command.type == RenderCommand::Type::CIRCLE) {
+            // Everything sharing a texture goes out in one geometry call
+            size_t runEnd = i + 1;
+            while (runEnd < count && sameTexture(commandsToDraw[runEnd], command)) {
+                runEnd++;
+            }
+            SDL_Texture* texture = getTexture(command);
+            if (texture) {
+                drawSpriteRun(commandsToDraw + i, runEnd - i, texture);
+                stateChanges++;
+            }
+            i = runEnd;
+            continue;
+        }
+
+        if (!currentColorValid || !sameColor(currentColor, command.color)) {
+            SDL_SetRenderDrawColor(renderer, command.color.r, command.color.g, command.color.b, command.color.a);
+            currentColor = command.color;
+            currentColorValid = true;
+            stateChanges++;
+        }
+
+        if (command.type == RenderCommand::Type::FILL_RECT) {
+            rects.clear();
+            size_t runEnd = i;
+            while (runEnd < count && commandsToDraw[runEnd].type == RenderCommand::Type::FILL_RECT &&
+                   sameColor(commandsToDraw[runEnd].color, command.color)) {
+                rects.push_back(place(commandsToDraw[runEnd]));
+                runEnd++;
+            }
+            SDL_RenderFillRects(renderer, rects.data(), static_cast<int>(rects.size()));
+            drawCalls++;
+            i = runEnd;
+        } else {
+            SDL_Rect start = place(command);
+            int endX = start.x + (command.lineEnd.x - command.dest.x);
+            int endY = start.y + (command.lineEnd.y - command.dest.y);
+            SDL_RenderDrawLine(renderer, start.x, start.y, endX, endY);
+            drawCalls++;
+            i++;
+        }
+    }
+}
+
+void RenderQueue::drawSpriteRun(const RenderCommand* run, size_t count, SDL_Texture* texture) {
+    int textureWidth = 0;
+    int textureHeight = 0;
+    SDL_QueryTexture(texture, nullptr, nullptr, &textureWidth, &textureHeight);
+    if (textureWidth <= 0 || textureHeight <= 0) return;
+
+    vertices.clear();
+    indices.clear();
+    for (size_t i = 0; i < count; i++) {
+        const RenderCommand& command = run[i];
+        SDL_Rect dest = place(command);
+        float u0 = static_cast<float>(command.source.x) / textureWidth;
+        float v0 = static_cast<float>(command.source.y) / textureHeight;
+        float u1 = static_cast<float>(command.source.x + command.source.w) / textureWidth;
+        float v1 = static_cast<float>(command.source.y + command.source.h) / textureHeight;
+
+        // Corners relative to the dest center, rotated the way SDL_RenderCopyEx does
+        float halfW = dest.w * 0.5f;
+        float halfH = dest.h * 0.5f;
+        float centerX = dest.x + halfW;
+        float centerY = dest.y + halfH;
+        float cosA = 1.0f;
+        float sinA = 0.0f;
+        if (command.angle != 0.0) {
+            float radians = static_cast<float>(command.angle * M_PI / 180.0);
+            cosA = std::cos(radians);
+            sinA = std::sin(radians);
+        }
+        const float cornerX[4] = {-halfW, halfW, halfW, -halfW};
+        const float cornerY[4] = {-halfH, -halfH, halfH, halfH};
+        const float cornerU[4] = {u0, u1, u1, u0};
+        const float cornerV[4] = {v0, v0, v1, v1};
+
+        int base = static_cast<int>(vertices.size());
+        for (int c = 0; c < 4; c++) {
+            SDL_Vertex vertex;
+            vertex.position.x = centerX + cornerX[c] * cosA - cornerY[c] * sinA;
+            vertex.position.y = centerY + cornerX[c] * sinA + cornerY[c] * cosA;
+            vertex.color = command.color;
+            vertex.tex_coord.x = cornerU[c];
+            vertex.tex_coord.y = cornerV[c];
+            vertices.push_back(vertex);
+        }
+        indices.push_back(base);
+        indices.push_back(base + 1);
+        indices.push_back(base + 2);
+        indices.push_back(base);
+        indices.push_back(base + 2);
+        indices.push_back(base + 3);
+    }
+
+    // Vertex colors carry the tint; clear any mod left over from immediate draws
+    SDL_SetTextureColorMod(texture, 255, 255, 255);
+    SDL_SetTextureAlphaMod(texture, 255);
+
+    int result = SDL_RenderGeometry(renderer, texture,
+                                    vertices.data(), static_cast<int>(vertices.size()),
+                                    indices.data(), static_cast<int>(indices.size()));
+    drawCalls++;
+
+    if (result != 0) {
+        // Renderer without geometry support: one copy per sprite
+        drawCalls--;
+        for (size_t i = 0; i < count; i++) {
+            drawSpriteFallback(run[i], texture, place(run[i]));
+            drawCalls++;
+        }
+        SDL_SetTextureColorMod(texture, 255, 255, 255);
+        SDL_SetTextureAlphaMod(texture, 255);
+    }
+}
+
+void RenderQueue::drawSpriteFallback(const RenderCommand& command, SDL_Texture* texture, const SDL_Rect& dest) {
+    SDL_SetTextureColorMod(texture, command.color.r, command.color.g, command.color.b);
+    SDL_SetTextureAlphaMod(texture, command.color.a);
+    if (command.angle != 0.0) {
+        SDL_RenderCopyEx(renderer, texture, &command.source, &dest, command.angle, nullptr, SDL_FLIP_NONE);
+    } else {
+        SDL_RenderCopy(renderer, texture, &command.source, &dest);
+    }
+}
+
+void RenderQueue::resetStats() {
+    drawCalls = 0;
+    stateChanges = 0;
+}
@@ -0,0 +1,127 @@
+#pragma once
+#include <SDL2/SDL.h>
+#include <vector>
+#include "CircleCache.h"
+#include "SpriteAtlas.h"
+#include "Vector2.h"
+
+// Draw layers, back to front. Matches the order Game::render used to call
+// each object's render() in.
+enum class RenderLayer : Uint8 {
+    PLAYER,
+    WEAPONS,
+    PROJECTILES,
+    ENEMIES,
+    ENEMY_OVERLAY,  // Boss health bars
+    INDICATORS,     // Spawn telegraphs
+    PICKUPS
+};
+
+struct RenderCommand {
+    enum class Type : Uint8 {
+        SPRITE,     // Textured quad, optionally rotated, tinted per vertex
+        CIRCLE,     // Tinted CircleCache sprite; the texture is looked up when drawn
+        FILL_RECT,
+        LINE
+    };
+
+    Type type;
+    RenderLayer layer;
+    Sint16 depth;         // Ordering inside a layer for multi-part objects (base, detail, outline...)
+    SDL_Texture* texture; // SPRITE only
+    SDL_Rect source;      // SPRITE / CIRCLE: region of the texture
+    SDL_Rect dest;        // SPRITE / FILL_RECT: destination, LINE: x/y is the start point
+    SDL_Point lineEnd;    // LINE only
+    double angle;         // SPRITE: degrees clockwise around the dest center
+    SDL_Color color;      // Sprite tint or primitive color
+    CircleShape circleShape; // CIRCLE only
+    Sint16 circleRadius;
+    Sint16 circleParam;
+    Vector2 motion;       // Previous tick position minus current, see RenderQueue::interpolate
+    Uint32 sequence;      // Submission order, keeps sorting deterministic
+};
+
+// Entities submit what they want drawn instead of drawing immediately.
+// sort() orders by layer, then depth, then texture/color, so a mixed swarm of
+// enemies sharing an atlas page goes out as one SDL_RenderGeometry call and
+// primitives only change the draw color when they have to.
+//
+// Recording never touches SDL, so the simulation thread records a tick's
+// commands and the main thread draws them (see RenderSnapshot).
+class RenderQueue {
+public:
+    RenderQueue();
+
+    // Only needed for draw()
+    void setRenderer(SDL_Renderer* renderer) { this->renderer = renderer; }
+    SDL_Renderer* getRenderer() const { return renderer; }
+
+    // Objects submit at the current tick's position: interpolate() returns
+    // `current` and tags everything submitted after it with the move from
+    // `previous`. draw() shifts those commands back along it, so recorded
+    // commands can be drawn anywhere between the two ticks.
+    Vector2 interpolate(const Vector2& previous, const Vector2& current) {
+        motion = previous - current;
+        return current;
+    }
+    // For objects drawn where they are, without interpolation
+    void resetMotion() { motion = Vector2(0.0f, 0.0f); }
+
+    void submitSprite(RenderLayer layer, const Sprite& sprite, const SDL_Rect& dest,
+                      double angle = 0.0, SDL_Color tint = {255, 255, 255, 255}, int depth = 0);
+    void submitTexture(RenderLayer layer, SDL_Texture* texture, const SDL_Rect& source, const SDL_Rect& dest,
+                       double angle = 0.0, SDL_Color tint = {255, 255, 255, 255}, int depth = 0);
+
+    // Circles go through CircleCache's white sprites tinted per vertex, so
+    // every color of the same radius shares one texture
+    void submitCircle(RenderLayer layer, int centerX, int centerY, int radius, SDL_Color color,
+                      int glow = 0, Uint8 alpha = 255, int depth = 0);
+    void submitRing(RenderLayer layer, int centerX, int centerY, int radius, SDL_Color color,
+                    int dots, Uint8 alpha = 255, int depth = 0);
+
+    void submitRect(RenderLayer layer, const SDL_Rect& rect, SDL_Color color, int depth = 0);
+    void submitLine(RenderLayer layer, int x1, int y1, int x2, int y2, SDL_Color color, int depth = 0);
+
+    // Recorded commands, in draw order once sort() has run
+    void sort();
+    std::vector<RenderCommand>& getCommands() { return commands; }
+    void clear();
+
+    // Draws sorted `list` on layers firstLayer..lastLayer (inclusive), placed
+    // `alpha` (0..1) of the way from the previous tick to the current one.
+    // Main thread only.
+    void draw(const std::vector<RenderCommand>& list, RenderLayer firstLayer, RenderLayer lastLayer, float alpha);
+
+    // Draw stats accumulated since the last resetStats()
+    void resetStats();
+    int getDrawCalls() const { return drawCalls; }
+    int getStateChanges() const { return stateChanges; }
+
+private:
+    RenderCommand& push(RenderCommand::Type type, RenderLayer layer, int depth);
+    void submitCircleSprite(RenderLayer layer, CircleShape shape, int radius, int param, int centerX, int centerY,
+                            SDL_Color color, Uint8 alpha, int depth);
+    SDL_Rect place(const RenderCommand& command) const;
+    SDL_Texture* getTexture(const RenderCommand& command) const;
+    static bool sameTexture(const RenderCommand& a, const RenderCommand& b);
+    void drawSpriteRun(const RenderCommand* run, size_t count, SDL_Texture* texture);
+    void drawSpriteFallback(const RenderCommand& command, SDL_Texture* texture, const SDL_Rect& dest);
+
+    SDL_Renderer* renderer;
+    std::vector<RenderCommand> commands;
+    Uint32 nextSequence;
+    Vector2 motion; // Applied to the commands submitted next
+    float drawAlpha; // Set for the duration of draw()
+
+    // Reused between draws so steady-state rendering doesn't allocate
+    std::vector<SDL_Vertex> vertices;
+    std::vector<int> indices;
+    std::vector<SDL_Rect> rects;
+
+    // Draw color last set on the renderer during this draw
+    SDL_Color currentColor;
+    bool currentColorValid;
+
+    int drawCalls;
+    int stateChanges;
+};
@@ -0,0 +1,19 @@
+#include "RenderSnapshot.h"
+
+SnapshotBuffer::SnapshotBuffer() : latest(1), writeSlot(0), readSlot(2), hasSnapshot(false) {
+}
+
+void SnapshotBuffer::publish() {
+    // Hand the finished slot over and take whichever one the reader isn't using
+    int previous = latest.exchange(writeSlot | FRESH, std::memory_order_acq_rel);
+    writeSlot = previous & ~FRESH;
+}
+
+const RenderSnapshot* SnapshotBuffer::acquire() {
+    if (latest.load(std::memory_order_acquire) & FRESH) {
+        int newest = latest.exchange(readSlot, std::memory_order_acq_rel);
+        readSlot = newest & ~FRESH;
+        hasSnapshot = true;
+    }
+    return hasSnapshot ? &slots[readSlot] : nullptr;
+}
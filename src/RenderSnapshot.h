@@ -0,0 +1,62 @@
+#pragma once
+#include <SDL2/SDL.h>
+#include <atomic>
+#include <vector>
+#include "ProjectileBatch.h"
+#include "RenderQueue.h"
+
+// HUD numbers as of the snapshot's tick
+struct HudState {
+    int health;
+    int maxHealth;
+    int level;
+    int materials;
+    int wave;
+    int secondsLeft;
+    int experience;
+    int experienceToNextLevel;
+};
+
+// Everything the main thread needs to draw one simulation tick, recorded by
+// the simulation thread. Immutable once published.
+struct RenderSnapshot {
+    bool showWorld;  // Playing: world, HUD, and the shop if open
+    bool shopActive; // Shop and menu are drawn from their live state under Game::stateMutex
+    bool showMenu;
+
+    std::vector<RenderCommand> commands; // Sorted world commands (RenderQueue::sort)
+    std::vector<BulletSprite> bullets;
+    HudState hud;
+
+    // Interpolation: simulated time left over after the last tick, and when
+    // the snapshot was taken (SDL performance counter)
+    float leftoverSeconds;
+    Uint64 publishedAt;
+
+    int wavesCleared; // Game::clearWaveEntities() calls so far
+};
+
+// Lock-free triple buffer. The simulation thread fills one slot while the
+// main thread draws another; the third holds the newest finished snapshot,
+// so neither side ever waits for the other and storage is reused.
+class SnapshotBuffer {
+public:
+    SnapshotBuffer();
+
+    // Simulation thread: fill the slot returned by beginWrite(), then publish()
+    RenderSnapshot& beginWrite() { return slots[writeSlot]; }
+    void publish();
+
+    // Main thread: newest published snapshot, null until the first publish().
+    // The returned snapshot stays valid until the next acquire().
+    const RenderSnapshot* acquire();
+
+private:
+    static const int FRESH = 4; // Flag on `latest`: published since the last acquire()
+
+    RenderSnapshot slots[3];
+    std::atomic<int> latest; // Slot index | FRESH
+    int writeSlot;
+    int readSlot;
+    bool hasSnapshot;
+};
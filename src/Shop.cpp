@@ -1,16 +1,17 @@
 #include "Shop.h"
 #include "Player.h"
 #include "Game.h"
+#include "Profiler.h"
+#include "AllocationTracker.h"
 #include <random>
 #include <algorithm>
 #include <iostream>
 #include <cmath>
 #include <string>
 #include <cstring>
-#include <SDL2/SDL_image.h>
 
-std::string ShopItem::getWeaponName(WeaponType wType, WeaponTier wTier) {
-    std::string baseName;
+const char* ShopItem::getWeaponName(MemoryArena& arena, WeaponType wType, WeaponTier wTier) {
+    const char* baseName = "";
     switch (wType) {
         case WeaponType::PISTOL: baseName = "Pistol"; break;
         case WeaponType::SMG: baseName = "SMG"; break;
@@ -18,7 +19,7 @@ std::string ShopItem::getWeaponName(WeaponType wType, WeaponTier wTier) {
         case WeaponType::MELEE_STICK: baseName = "Melee Stick"; break;
     }
     
-    std::string tierName;
+    const char* tierName = "";
     switch (wTier) {
         case WeaponTier::TIER_1: tierName = ""; break;
         case WeaponTier::TIER_2: tierName = "Tier 2 "; break;
@@ -26,10 +27,10 @@ std::string ShopItem::getWeaponName(WeaponType wType, WeaponTier wTier) {
         case WeaponTier::TIER_4: tierName = "Tier 4 "; break;
     }
     
-    return tierName + baseName;
+    return arena.format("%s%s", tierName, baseName);
 }
 
-std::string ShopItem::getWeaponDescription(WeaponType wType, WeaponTier wTier) {
+const char* ShopItem::getWeaponDescription(WeaponType wType, WeaponTier wTier) {
     switch (wType) {
         case WeaponType::PISTOL:
             return "Pierces 1 enemy, -50% damage to 2nd";
@@ -55,37 +56,56 @@ Shop::~Shop() {
 
 void Shop::loadAssets(SDL_Renderer* renderer) {
     // Load UI textures. These are optional; if missing we fall back to rects.
-    texCardNormal = loadTexture("assets/ui/card_normal.png", renderer);
-    texCardSelected = loadTexture("assets/ui/card_selected.png", renderer);
-    texCardLocked = loadTexture("assets/ui/card_locked.png", renderer);
-    texCoin = loadTexture("assets/ui/coin.png", renderer);
-    texLock = loadTexture("assets/ui/lock.png", renderer);
-    texLockLocked = loadTexture("assets/ui/lock_locked.png", renderer);
-    texReroll = loadTexture("assets/ui/reroll.png", renderer);
-    texWeaponPistol = loadTexture("assets/weapons/pistol.png", renderer);
-    texWeaponSMG = loadTexture("assets/weapons/smg.png", renderer);
-    texWeaponShotgun = loadTexture("assets/weapons/shotgun.png", renderer);
+    // Nobody sees the shop before the first wave ends, so it streams in last.
+    const AssetPriority priority = AssetPriority::LOW;
+    texCardNormal = SpriteAtlas::get(renderer, "assets/ui/card_normal.png", priority);
+    texCardSelected = SpriteAtlas::get(renderer, "assets/ui/card_selected.png", priority);
+    texCardLocked = SpriteAtlas::get(renderer, "assets/ui/card_locked.png", priority);
+    texCoin = SpriteAtlas::get(renderer, "assets/ui/coin.png", priority);
+    texLock = SpriteAtlas::get(renderer, "assets/ui/lock.png", priority);
+    texLockLocked = SpriteAtlas::get(renderer, "assets/ui/lock_locked.png", priority);
+    texReroll = SpriteAtlas::get(renderer, "assets/ui/reroll.png", priority);
+    texWeaponPistol = SpriteAtlas::get(renderer, "assets/weapons/pistol.png", priority);
+    texWeaponSMG = SpriteAtlas::get(renderer, "assets/weapons/smg.png", priority);
+    texWeaponShotgun = SpriteAtlas::get(renderer, "assets/weapons/shotgun.png", priority);
 }
 
 void Shop::unloadAssets() {
-    auto destroyIf = [](SDL_Texture*& t) {
-        if (t) { SDL_DestroyTexture(t); t = nullptr; }
-    };
-    destroyIf(texCardNormal);
-    destroyIf(texCardSelected);
-    destroyIf(texCardLocked);
-    destroyIf(texCoin);
-    destroyIf(texLock);
-    destroyIf(texLockLocked);
-    destroyIf(texReroll);
-    destroyIf(texWeaponPistol);
-    destroyIf(texWeaponSMG);
-    destroyIf(texWeaponShotgun);
+    if (panelTexture) {
+        SDL_DestroyTexture(panelTexture);
+        panelTexture = nullptr;
+    }
+    panelDirty = true;
+    texCardNormal = Sprite();
+    texCardSelected = Sprite();
+    texCardLocked = Sprite();
+    texCoin = Sprite();
+    texLock = Sprite();
+    texLockLocked = Sprite();
+    texReroll = Sprite();
+    texWeaponPistol = Sprite();
+    texWeaponSMG = Sprite();
+    texWeaponShotgun = Sprite();
+}
+
+const Sprite* Shop::getWeaponIcon(WeaponType weaponType) const {
+    const Sprite* icon = nullptr;
+    switch (weaponType) {
+        case WeaponType::PISTOL: icon = &texWeaponPistol; break;
+        case WeaponType::SMG: icon = &texWeaponSMG; break;
+        case WeaponType::SHOTGUN: icon = &texWeaponShotgun; break;
+        case WeaponType::MELEE_STICK: icon = nullptr; break; // No icon for melee yet
+    }
+    return (icon && icon->texture()) ? icon : nullptr;
 }
 
 void Shop::generateItems(int waveNumber, int playerLuck) {
     items.clear();
     
+    // Item names live until the wave arena resets at the end of the next wave
+    MemoryArena& waveArena = gameRef->getWaveArena();
+    MemoryArena& frameArena = gameRef->getFrameArena();
+    
     static std::random_device rd;
     static std::mt19937 gen(rd());
     
@@ -93,7 +113,7 @@ void Shop::generateItems(int waveNumber, int playerLuck) {
     if (waveNumber == 1) {
         // First item is guaranteed shotgun T1
         int shotgunPrice = calculateItemPrice(WeaponType::SHOTGUN, WeaponTier::TIER_1, waveNumber);
-        items.emplace_back(WeaponType::SHOTGUN, WeaponTier::TIER_1, shotgunPrice);
+        items.emplace_back(WeaponType::SHOTGUN, WeaponTier::TIER_1, shotgunPrice, waveArena);
         
         // Generate 3 more random items
         for (int i = 1; i < MAX_SHOP_ITEMS; i++) {
@@ -111,7 +131,7 @@ void Shop::generateItems(int waveNumber, int playerLuck) {
             WeaponTier tier = WeaponTier::TIER_1;
             
             int price = calculateItemPrice(weaponType, tier, waveNumber);
-            items.emplace_back(weaponType, tier, price);
+            items.emplace_back(weaponType, tier, price, waveArena);
         }
     }
     else {
@@ -128,7 +148,8 @@ void Shop::generateItems(int waveNumber, int playerLuck) {
             }
             
             // Choose tier based on wave number (Brotato tier restrictions)
-            std::vector<WeaponTier> availableTiers;
+            ArenaVector<WeaponTier> availableTiers{ArenaAllocator<WeaponTier>(frameArena)};
+            availableTiers.reserve(4);
             availableTiers.push_back(WeaponTier::TIER_1);
             
             if (waveNumber >= 2) availableTiers.push_back(WeaponTier::TIER_2);
@@ -139,7 +160,7 @@ void Shop::generateItems(int waveNumber, int playerLuck) {
             WeaponTier tier = availableTiers[tierDist(gen)];
             
             int price = calculateItemPrice(weaponType, tier, waveNumber);
-            items.emplace_back(weaponType, tier, price);
+            items.emplace_back(weaponType, tier, price, waveArena);
         }
     }
 }
@@ -150,6 +171,7 @@ void Shop::openShop(int waveNumber) {
     rerollCount = 0;
     selectedItem = 0;
     generateItems(waveNumber);
+    panelDirty = true;
     
     std::cout << "Shop opened after wave " << waveNumber << std::endl;
 }
@@ -157,11 +179,67 @@ void Shop::openShop(int waveNumber) {
 void Shop::closeShop() {
     active = false;
     items.clear();
+    panelDirty = true;
+}
+
+bool Shop::ensurePanelTexture(SDL_Renderer* renderer, int width, int height) {
+    if (panelTexture && panelWidth == width && panelHeight == height) {
+        return true;
+    }
+
+    if (panelTexture) {
+        SDL_DestroyTexture(panelTexture);
+        panelTexture = nullptr;
+    }
+
+    panelTexture = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_TARGET, width, height);
+    if (!panelTexture) {
+        std::cout << "Unable to create shop panel texture, drawing directly! SDL Error: " << SDL_GetError() << std::endl;
+        return false;
+    }
+
+    SDL_SetTextureBlendMode(panelTexture, SDL_BLENDMODE_BLEND);
+    panelWidth = width;
+    panelHeight = height;
+    panelDirty = true;
+    return true;
 }
 
 void Shop::render(SDL_Renderer* renderer, int windowWidth, int windowHeight) {
     if (!active) return;
-    
+    PROFILE_ZONE("Shop::render");
+    ALLOC_SCOPE("shop");
+
+    // Materials and weapons can also change outside the shop's own actions
+    const Player* player = gameRef ? gameRef->getPlayer() : nullptr;
+    int materials = player ? player->getStats().materials : -1;
+    int weaponCount = player ? player->getWeaponCount() : -1;
+    if (materials != panelMaterials || weaponCount != panelWeaponCount) {
+        panelMaterials = materials;
+        panelWeaponCount = weaponCount;
+        panelDirty = true;
+    }
+
+    if (!ensurePanelTexture(renderer, windowWidth, windowHeight)) {
+        // No render target support: immediate mode as before
+        renderPanel(renderer, windowWidth, windowHeight);
+        return;
+    }
+
+    // Clear the flag before drawing so an invalidation that lands mid-redraw isn't lost
+    if (panelDirty.exchange(false)) {
+        SDL_Texture* previousTarget = SDL_GetRenderTarget(renderer);
+        SDL_SetRenderTarget(renderer, panelTexture);
+        SDL_SetRenderDrawColor(renderer, 0, 0, 0, 0);
+        SDL_RenderClear(renderer);
+        renderPanel(renderer, windowWidth, windowHeight);
+        SDL_SetRenderTarget(renderer, previousTarget);
+    }
+
+    SDL_RenderCopy(renderer, panelTexture, nullptr, nullptr);
+}
+
+void Shop::renderPanel(SDL_Renderer* renderer, int windowWidth, int windowHeight) {
     // Proper shop layout - centered with room for stats panel on right
     int statsWidth = 350; // Fixed width for stats panel
     int margin = 50; // Margins around elements
@@ -249,16 +327,11 @@ void Shop::render(SDL_Renderer* renderer, int windowWidth, int windowHeight) {
                 SDL_SetRenderDrawColor(renderer, 120, 130, 150, 255);
                 SDL_RenderDrawRect(renderer, &slot);
                 if (i < (int)owned.size()) {
-                    SDL_Texture* icon = nullptr;
-                    switch (owned[i]->getType()) {
-                        case WeaponType::PISTOL: icon = texWeaponPistol; break;
-                        case WeaponType::SMG: icon = texWeaponSMG; break;
-                        case WeaponType::SHOTGUN: icon = texWeaponShotgun; break;
-                        case WeaponType::MELEE_STICK: icon = nullptr; break;
-                    }
+                    const Sprite* icon = getWeaponIcon(owned[i]->getType());
                     if (icon) {
                         SDL_Rect ir = {cx + 8, cy + 8, wSlotSize - 16, wSlotSize - 16};
-                        SDL_RenderCopy(renderer, icon, nullptr, &ir);
+                        SDL_Rect region = icon->region();
+                        SDL_RenderCopy(renderer, icon->texture(), &region, &ir);
                     }
                     // Highlight if selected
                     if (selectedOwnedWeapon == i) {
@@ -328,21 +401,16 @@ void Shop::renderShopItem(SDL_Renderer* renderer, const ShopItem& item, int x, i
     SDL_RenderDrawRect(renderer, &itemRect);
     
     // Weapon icon - larger and centered
-    SDL_Texture* icon = nullptr;
-    switch (item.weaponType) {
-        case WeaponType::PISTOL: icon = texWeaponPistol; break;
-        case WeaponType::SMG: icon = texWeaponSMG; break;
-        case WeaponType::SHOTGUN: icon = texWeaponShotgun; break;
-        case WeaponType::MELEE_STICK: icon = nullptr; break; // No icon for melee yet
-    }
+    const Sprite* icon = getWeaponIcon(item.weaponType);
     if (icon) {
         SDL_Rect ir = {x + width/2 - 24, y + 10, 48, 48};
-        SDL_RenderCopy(renderer, icon, nullptr, &ir);
+        SDL_Rect region = icon->region();
+        SDL_RenderCopy(renderer, icon->texture(), &region, &ir);
     }
 
     // Item name - use TTF text
     SDL_Color itemWhite = {255, 255, 255, 255};
-    renderTTFText(renderer, item.name.c_str(), x + 10, y + 65, itemWhite, 14);
+    renderTTFText(renderer, item.name, x + 10, y + 65, itemWhite, 14);
     
     // Price with BUY button
     int buttonY = y + height - 50;
@@ -535,6 +603,7 @@ void Shop::buyItem(int index, Player& player) {
             
             // Remove item from shop
             items.erase(items.begin() + index);
+            panelDirty = true;
         }
     } else {
         std::cout << "Not enough materials! Need " << item.price << ", have " << player.getStats().materials << std::endl;
@@ -545,6 +614,7 @@ void Shop::lockItem(int index) {
     if (index >= items.size()) return;
     
     items[index].locked = !items[index].locked;
+    panelDirty = true;
     std::cout << "Item " << (items[index].locked ? "locked" : "unlocked") << std::endl;
 }
 
@@ -556,7 +626,7 @@ void Shop::reroll(Player& player, int waveNumber) {
         rerollCount++;
         
         // Keep locked items, regenerate others
-        std::vector<ShopItem> lockedItems;
+        ArenaVector<ShopItem> lockedItems{ArenaAllocator<ShopItem>(gameRef->getFrameArena())};
         for (const auto& item : items) {
             if (item.locked) {
                 lockedItems.push_back(item);
@@ -569,6 +639,7 @@ void Shop::reroll(Player& player, int waveNumber) {
         for (int i = 0; i < lockedItems.size() && i < items.size(); i++) {
             items[i] = lockedItems[i];
         }
+        panelDirty = true;
         
         std::cout << "Rerolled shop for " << rerollPrice << " materials" << std::endl;
     } else {
@@ -615,23 +686,11 @@ void Shop::renderTTFText(SDL_Renderer* renderer, const char* text, int x, int y,
     }
 }
 
-SDL_Texture* Shop::loadTexture(const char* path, SDL_Renderer* renderer) {
-    SDL_Surface* surface = IMG_Load(path);
-    if (!surface) {
-        std::cout << "Unable to load image " << path << "! SDL_image Error: " << IMG_GetError() << std::endl;
-        return nullptr;
-    }
-    SDL_Texture* texture = SDL_CreateTextureFromSurface(renderer, surface);
-    SDL_FreeSurface(surface);
-    if (!texture) {
-        std::cout << "Unable to create texture from " << path << "! SDL Error: " << SDL_GetError() << std::endl;
-    }
-    return texture;
-}
-
 void Shop::handleMouseInput(int mouseX, int mouseY, bool mousePressed, Player& player) {
     if (!active) return;
     
+    int previousHovered = hoveredItem;
+    int previousSelectedOwned = selectedOwnedWeapon;
     hoveredItem = -1;
     
     // Calculate shop layout (same as in render method)
@@ -717,5 +776,9 @@ void Shop::handleMouseInput(int mouseX, int mouseY, bool mousePressed, Player& p
         }
     }
     
+    if (hoveredItem != previousHovered || selectedOwnedWeapon != previousSelectedOwned) {
+        panelDirty = true;
+    }
+    
     lastMousePressed = mousePressed;
 }
\ No newline at end of file
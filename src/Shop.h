@@ -1,9 +1,12 @@
 #pragma once
 #include <SDL2/SDL.h>
+#include <atomic>
 #include <vector>
 #include <memory>
 #include <string>
 #include "Weapon.h"
+#include "SpriteAtlas.h"
+#include "MemoryArena.h"
 
 class Player;
 class Game;
@@ -19,21 +22,21 @@ struct ShopItem {
     WeaponTier tier;
     int price;
     bool locked;
-    std::string name;
-    std::string description;
+    const char* name;        // Lives in the wave arena
+    const char* description; // String literal
     
-    ShopItem(WeaponType wType, WeaponTier wTier, int cost) 
+    ShopItem(WeaponType wType, WeaponTier wTier, int cost, MemoryArena& nameArena) 
         : type(ShopItemType::WEAPON), weaponType(wType), tier(wTier), 
           price(cost), locked(false) {
         
         // Generate name and description
-        name = getWeaponName(wType, wTier);
+        name = getWeaponName(nameArena, wType, wTier);
         description = getWeaponDescription(wType, wTier);
     }
     
 private:
-    std::string getWeaponName(WeaponType wType, WeaponTier wTier);
-    std::string getWeaponDescription(WeaponType wType, WeaponTier wTier);
+    static const char* getWeaponName(MemoryArena& arena, WeaponType wType, WeaponTier wTier);
+    static const char* getWeaponDescription(WeaponType wType, WeaponTier wTier);
 };
 
 class Shop {
@@ -47,6 +50,9 @@ public:
     
     void generateItems(int waveNumber, int playerLuck = 0);
     void render(SDL_Renderer* renderer, int windowWidth, int windowHeight);
+    // Forces the cached panel to be redrawn (e.g. after the render targets were
+    // reset, or streamed art arrived). Safe without the game's state lock.
+    void invalidatePanel() { panelDirty = true; }
     void handleInput(const Uint8* keyState, Player& player);
     void handleMouseInput(int mouseX, int mouseY, bool mousePressed, Player& player);
     
@@ -66,12 +72,14 @@ private:
     int currentWave;
     
     // UI helpers
+    void renderPanel(SDL_Renderer* renderer, int windowWidth, int windowHeight);
+    bool ensurePanelTexture(SDL_Renderer* renderer, int width, int height);
     void renderShopItem(SDL_Renderer* renderer, const ShopItem& item, int x, int y, int width, int height, bool highlighted, int index);
     void renderCharacterStats(SDL_Renderer* renderer, int x, int y, int width, int height);
     void renderText(SDL_Renderer* renderer, const char* text, int x, int y, int scale = 1);
     void renderNumber(SDL_Renderer* renderer, int number, int x, int y, int scale = 1);
     void renderTTFText(SDL_Renderer* renderer, const char* text, int x, int y, SDL_Color color, int fontSize = 16);
-    SDL_Texture* loadTexture(const char* path, SDL_Renderer* renderer);
+    const Sprite* getWeaponIcon(WeaponType weaponType) const;
     
     // Shop logic
     int calculateItemPrice(WeaponType weaponType, WeaponTier tier, int waveNumber);
@@ -89,15 +97,24 @@ private:
     
     static const int MAX_SHOP_ITEMS = 4;
 
-    // UI textures
-    SDL_Texture* texCardNormal = nullptr;
-    SDL_Texture* texCardSelected = nullptr;
-    SDL_Texture* texCardLocked = nullptr;
-    SDL_Texture* texCoin = nullptr;
-    SDL_Texture* texLock = nullptr;
-    SDL_Texture* texLockLocked = nullptr;
-    SDL_Texture* texReroll = nullptr;
-    SDL_Texture* texWeaponPistol = nullptr;
-    SDL_Texture* texWeaponSMG = nullptr;
-    SDL_Texture* texWeaponShotgun = nullptr;
+    // UI sprites (atlas sub-rects; weapon icons reuse the weapon sprites)
+    Sprite texCardNormal;
+    Sprite texCardSelected;
+    Sprite texCardLocked;
+    Sprite texCoin;
+    Sprite texLock;
+    Sprite texLockLocked;
+    Sprite texReroll;
+    Sprite texWeaponPistol;
+    Sprite texWeaponSMG;
+    Sprite texWeaponShotgun;
+
+    // Retained panel: the whole shop is drawn into a target texture and only
+    // redrawn when something it shows changes, idle frames are a single copy
+    SDL_Texture* panelTexture = nullptr;
+    int panelWidth = 0;
+    int panelHeight = 0;
+    std::atomic<bool> panelDirty{true};
+    int panelMaterials = -1;   // Player state the cached panel was drawn with
+    int panelWeaponCount = -1;
 };
\ No newline at end of file
@@ -1,11 +1,11 @@
 #include "SnakeBoss.h"
-#include "Bullet.h"
+#include "SpawnQueue.h"
 #include <cmath>
 #include <iostream>
 
-SnakeBoss::SnakeBoss(Vector2 pos, SDL_Renderer* renderer, int currentWave)
-    : Enemy(pos, renderer), spawnWave(currentWave), segmentDistance(40.0f), 
-      headRadius(50.0f), maxHistoryLength(50u) {
+SnakeBoss::SnakeBoss(Vector2 pos, int currentWave)
+    : Enemy(pos), spawnWave(currentWave), segmentDistance(40.0f), 
+      headRadius(50.0f), maxHistoryLength(50u), historySampleTimer(0.0f) {
     
     // Set boss characteristics according to requirements
     health = 500;
@@ -16,6 +16,7 @@ SnakeBoss::SnakeBoss(Vector2 pos, SDL_Renderer* renderer, int currentWave)
     
     // Initialize segments
     initializeSegments();
+    refreshCollider();
     
     std::cout << "Snake Boss spawned on wave " << currentWave << " with " << maxHealth << " health" << std::endl;
 }
@@ -57,22 +58,36 @@ void SnakeBoss::updateMovement(float deltaTime, Vector2 playerPos) {
     segments[0].position = newHeadPos;
     
     // Store head position in history
-    headPositionHistory.insert(headPositionHistory.begin(), newHeadPos);
-    if (headPositionHistory.size() > maxHistoryLength) {
-        headPositionHistory.pop_back();
+    historySampleTimer += deltaTime;
+    while (historySampleTimer >= HISTORY_SAMPLE_INTERVAL) {
+        historySampleTimer -= HISTORY_SAMPLE_INTERVAL;
+        headPositionHistory.insert(headPositionHistory.begin(), newHeadPos);
+        if (headPositionHistory.size() > maxHistoryLength) {
+            headPositionHistory.pop_back();
+        }
     }
     
     // Update main position (for collision detection and other systems)
     position = segments[0].position;
     
     // Update body segments to follow the head
-    updateSegmentPositions();
+    updateSegmentPositions(deltaTime);
+}
+
+void SnakeBoss::beginTick() {
+    Enemy::beginTick();
+    for (auto& segment : segments) {
+        segment.previousPosition = segment.position;
+    }
 }
 
-void SnakeBoss::updateSegmentPositions() {
+void SnakeBoss::updateSegmentPositions(float deltaTime) {
     // Calculate how many history positions to skip per segment
     size_t historyStep = maxHistoryLength / segments.size();
     
+    // Chase 10% of the gap per 60 Hz frame, whatever the tick rate is
+    float followFactor = 1.0f - std::pow(0.9f, deltaTime * 60.0f);
+    
     for (size_t i = 1; i < segments.size(); i++) {
         size_t historyIndex = i * historyStep;
         if (historyIndex < headPositionHistory.size()) {
@@ -80,24 +95,32 @@ void SnakeBoss::updateSegmentPositions() {
             
             // Smooth interpolation to target position for more natural movement
             Vector2 diff = targetPos - segments[i].position;
-            segments[i].position += diff * 0.1f;
+            segments[i].position += diff * followFactor;
         }
     }
 }
 
-void SnakeBoss::updateShooting(float deltaTime, Vector2 playerPos, std::vector<std::unique_ptr<Bullet>>& bullets) {
+void SnakeBoss::refreshCollider() {
+    collider.clear();
+    for (const auto& segment : segments) {
+        collider.add(segment.position, segment.radius);
+    }
+    collider.build();
+}
+
+void SnakeBoss::updateShooting(float deltaTime, Vector2 playerPos, SpawnBuffer& spawns) {
     // Update shoot timers and shoot for each segment
     for (size_t i = 0; i < segments.size(); i++) {
         segments[i].timeSinceLastShot += deltaTime;
         
         if (segments[i].timeSinceLastShot >= segments[i].shootCooldown) {
-            shootFromSegment(i, playerPos, bullets);
+            shootFromSegment(i, playerPos, spawns);
             segments[i].timeSinceLastShot = 0.0f;
         }
     }
 }
 
-void SnakeBoss::shootFromSegment(int segmentIndex, Vector2 playerPos, std::vector<std::unique_ptr<Bullet>>& bullets) {
+void SnakeBoss::shootFromSegment(int segmentIndex, Vector2 playerPos, SpawnBuffer& spawns) {
     if (static_cast<size_t>(segmentIndex) >= segments.size()) return;
     
     const SnakeSegment& segment = segments[segmentIndex];
@@ -114,109 +137,101 @@ void SnakeBoss::shootFromSegment(int segmentIndex, Vector2 playerPos, std::vecto
         bulletRange = 700.0f;
     }
     
-    bullets.push_back(std::make_unique<Bullet>(
+    spawns.spawnBullet(
         segment.position, direction,
         bulletDamage, bulletRange, bulletSpeed,
         segment.bulletType, /*enemyOwned*/ true
-    ));
+    );
 }
 
 void SnakeBoss::removeLastSegment() {
     if (segments.size() > 1) { // Never remove the head
         segments.pop_back();
+        refreshCollider();
         std::cout << "Snake segment destroyed! Remaining segments: " << segments.size() << std::endl;
     }
 }
 
-void SnakeBoss::renderHealthBar(SDL_Renderer* renderer) {
+void SnakeBoss::renderHealthBar(RenderQueue& queue) {
     // Health bar dimensions
     int barWidth = 150;
     int barHeight = 15;
-    int barX = static_cast<int>(segments[0].position.x - static_cast<float>(barWidth) / 2.0f);
-    int barY = static_cast<int>(segments[0].position.y - headRadius - 25);
+    Vector2 headPos = queue.interpolate(segments[0].previousPosition, segments[0].position);
+    int barX = static_cast<int>(headPos.x - static_cast<float>(barWidth) / 2.0f);
+    int barY = static_cast<int>(headPos.y - headRadius - 25);
     
     // Background bar (Yellow border)
-    SDL_SetRenderDrawColor(renderer, 255, 255, 0, 255);
     SDL_Rect bgRect = {barX - 2, barY - 2, barWidth + 4, barHeight + 4};
-    SDL_RenderFillRect(renderer, &bgRect);
+    queue.submitRect(RenderLayer::ENEMY_OVERLAY, bgRect, {255, 255, 0, 255}, 0);
     
     // Black bar (missing health)
-    SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255);
     SDL_Rect fullRect = {barX, barY, barWidth, barHeight};
-    SDL_RenderFillRect(renderer, &fullRect);
+    queue.submitRect(RenderLayer::ENEMY_OVERLAY, fullRect, {0, 0, 0, 255}, 1);
     
     // Red bar (current health)
     float healthPercent = static_cast<float>(health) / static_cast<float>(maxHealth);
     int healthWidth = static_cast<int>(barWidth * healthPercent);
-    SDL_SetRenderDrawColor(renderer, 200, 0, 0, 255);
     SDL_Rect healthRect = {barX, barY, healthWidth, barHeight};
-    SDL_RenderFillRect(renderer, &healthRect);
+    queue.submitRect(RenderLayer::ENEMY_OVERLAY, healthRect, {200, 0, 0, 255}, 2);
 }
 
-void SnakeBoss::renderSegment(SDL_Renderer* renderer, const SnakeSegment& segment, bool isHead) {
+void SnakeBoss::renderSegment(RenderQueue& queue, const SnakeSegment& segment, int drawIndex, bool isHead) {
     // Set color based on segment type
+    SDL_Color color;
     if (isHead) {
-        SDL_SetRenderDrawColor(renderer, 255, 100, 100, 255); // Light red for head
+        color = {255, 100, 100, 255}; // Light red for head
     } else {
         // Different colors for body segments based on bullet type
         switch (segment.bulletType) {
             case BulletType::SNAKE_BODY1:
-                SDL_SetRenderDrawColor(renderer, 100, 255, 100, 255); // Light green
+                color = {100, 255, 100, 255}; // Light green
                 break;
             case BulletType::SNAKE_BODY2:
-                SDL_SetRenderDrawColor(renderer, 100, 100, 255, 255); // Light blue
+                color = {100, 100, 255, 255}; // Light blue
                 break;
             case BulletType::SNAKE_BODY3:
-                SDL_SetRenderDrawColor(renderer, 255, 255, 100, 255); // Light yellow
+                color = {255, 255, 100, 255}; // Light yellow
                 break;
             default:
-                SDL_SetRenderDrawColor(renderer, 150, 150, 150, 255); // Gray fallback
+                color = {150, 150, 150, 255}; // Gray fallback
                 break;
         }
     }
     
     // Draw circle for segment
-    int centerX = static_cast<int>(segment.position.x);
-    int centerY = static_cast<int>(segment.position.y);
+    Vector2 renderPos = queue.interpolate(segment.previousPosition, segment.position);
+    int centerX = static_cast<int>(renderPos.x);
+    int centerY = static_cast<int>(renderPos.y);
     int r = static_cast<int>(segment.radius);
-    
-    for (int y = -r; y <= r; y++) {
-        for (int x = -r; x <= r; x++) {
-            if (x*x + y*y <= r*r) {
-                SDL_RenderDrawPoint(renderer, centerX + x, centerY + y);
-            }
-        }
-    }
+    // Segments overlap, so each one gets its own depth to keep tail-to-head order
+    queue.submitCircle(RenderLayer::ENEMIES, centerX, centerY, r, color, 0, 255, drawIndex * 2);
     
     // Draw darker border for better visibility
-    SDL_SetRenderDrawColor(renderer, 50, 50, 50, 255);
-    for (int angle = 0; angle < 360; angle += 10) {
-        float radAngle = angle * M_PI / 180.0f;
-        int borderX = centerX + static_cast<int>(r * cos(radAngle));
-        int borderY = centerY + static_cast<int>(r * sin(radAngle));
-        SDL_RenderDrawPoint(renderer, borderX, borderY);
-    }
+    queue.submitRing(RenderLayer::ENEMIES, centerX, centerY, r, {50, 50, 50, 255}, 36, 255, drawIndex * 2 + 1);
 }
 
-void SnakeBoss::render(SDL_Renderer* renderer) {
+void SnakeBoss::render(RenderQueue& queue) {
     // Render all segments (body first, then head)
+    int drawIndex = 0;
     for (size_t i = segments.size(); i > 0; i--) {
         bool isHead = (i - 1 == 0);
-        renderSegment(renderer, segments[i - 1], isHead);
+        renderSegment(queue, segments[i - 1], drawIndex++, isHead);
     }
     
     // Render health bar above head
-    renderHealthBar(renderer);
+    renderHealthBar(queue);
 }
 
-void SnakeBoss::update(float deltaTime, Vector2 playerPos, std::vector<std::unique_ptr<Bullet>>& bullets) {
+void SnakeBoss::update(float deltaTime, Vector2 playerPos, SpawnBuffer& spawns) {
     if (!alive) return;
     
     // Update movement
     updateMovement(deltaTime, playerPos);
     
+    refreshCollider();
+    
     // Update shooting
-    updateShooting(deltaTime, playerPos, bullets);
+    updateShooting(deltaTime, playerPos, spawns);
     
     // Base animation from parent class
     animationTimer += deltaTime;
@@ -246,6 +261,6 @@ void SnakeBoss::takeDamage(int damage) {
 }
 
 // Factory function
-std::unique_ptr<Enemy> CreateSnakeBoss(const Vector2& pos, SDL_Renderer* renderer, int wave) {
-    return std::make_unique<SnakeBoss>(pos, renderer, wave);
+std::unique_ptr<Enemy> CreateSnakeBoss(const Vector2& pos, int wave) {
+    return std::make_unique<SnakeBoss>(pos, wave);
 }
@@ -1,30 +1,32 @@
 #pragma once
 #include "Enemy.h"
-#include "Bullet.h"
+#include "SpawnQueue.h"
 #include <vector>
 
 struct SnakeSegment {
     Vector2 position;
+    Vector2 previousPosition; // Position at the start of the tick, for render interpolation
     float radius;
     float timeSinceLastShot;
     float shootCooldown;
     BulletType bulletType;
     
     SnakeSegment(Vector2 pos, float r, BulletType type) 
-        : position(pos), radius(r), timeSinceLastShot(0.0f), 
+        : position(pos), previousPosition(pos), radius(r), timeSinceLastShot(0.0f), 
           shootCooldown(1.5f), bulletType(type) {}
 };
 
 class SnakeBoss : public Enemy {
 public:
-    SnakeBoss(Vector2 pos, SDL_Renderer* renderer, int currentWave);
+    SnakeBoss(Vector2 pos, int currentWave);
     ~SnakeBoss() override;
     
-    void update(float deltaTime, Vector2 playerPos, std::vector<std::unique_ptr<Bullet>>& bullets) override;
-    void render(SDL_Renderer* renderer) override;
+    void beginTick() override;
+    void update(float deltaTime, Vector2 playerPos, SpawnBuffer& spawns) override;
+    void render(RenderQueue& queue) override;
     void takeDamage(int damage) override;
-
-    bool isBoss() const override { return true; }
+    // Head and every body segment are solid
+    const CompoundCollider* getCollider() const override { return &collider; }
     
 private:
     // Snake characteristics
@@ -33,21 +35,26 @@ private:
     std::vector<SnakeSegment> segments;
     float segmentDistance;     // Distance between segments
     float headRadius;
+    CompoundCollider collider; // One part per segment, head first
     
-    // Movement tracking
+    // Movement tracking. The head's trail is sampled at a fixed rate so segment
+    // spacing doesn't depend on the simulation tick rate.
     std::vector<Vector2> headPositionHistory;
     size_t maxHistoryLength;
+    float historySampleTimer;
+    static constexpr float HISTORY_SAMPLE_INTERVAL = 1.0f / 60.0f;
     
     // Methods
     void initializeSegments();
     void updateMovement(float deltaTime, Vector2 playerPos);
-    void updateSegmentPositions();
-    void updateShooting(float deltaTime, Vector2 playerPos, std::vector<std::unique_ptr<Bullet>>& bullets);
-    void shootFromSegment(int segmentIndex, Vector2 playerPos, std::vector<std::unique_ptr<Bullet>>& bullets);
+    void updateSegmentPositions(float deltaTime);
+    void updateShooting(float deltaTime, Vector2 playerPos, SpawnBuffer& spawns);
+    void shootFromSegment(int segmentIndex, Vector2 playerPos, SpawnBuffer& spawns);
     void removeLastSegment();
-    void renderHealthBar(SDL_Renderer* renderer);
-    void renderSegment(SDL_Renderer* renderer, const SnakeSegment& segment, bool isHead = false);
+    void refreshCollider();
+    void renderHealthBar(RenderQueue& queue);
+    void renderSegment(RenderQueue& queue, const SnakeSegment& segment, int drawIndex, bool isHead = false);
 };
 
 // Factory function
-std::unique_ptr<Enemy> CreateSnakeBoss(const Vector2& pos, SDL_Renderer* renderer, int wave);
+std::unique_ptr<Enemy> CreateSnakeBoss(const Vector2& pos, int wave);
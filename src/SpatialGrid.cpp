@@ -0,0 +1,80 @@
+#include "SpatialGrid.h"
+#include <algorithm>
+#include <cmath>
+
+SpatialGrid::SpatialGrid(float worldWidth, float worldHeight, float size)
+    : cellSize(size), inverseCellSize(1.0f / size),
+      columns(std::max(1, static_cast<int>(std::ceil(worldWidth / size)))),
+      rows(std::max(1, static_cast<int>(std::ceil(worldHeight / size)))),
+      maxRadius(0.0f) {
+    cellStart.assign(columns * rows + 1, 0);
+    cellCursor.assign(columns * rows, 0);
+}
+
+int SpatialGrid::columnAt(float x) const {
+    float column = std::floor(x * inverseCellSize);
+    return static_cast<int>(std::min(std::max(column, 0.0f), static_cast<float>(columns - 1)));
+}
+
+int SpatialGrid::rowAt(float y) const {
+    float row = std::floor(y * inverseCellSize);
+    return static_cast<int>(std::min(std::max(row, 0.0f), static_cast<float>(rows - 1)));
+}
+
+void SpatialGrid::clear() {
+    // Vectors keep their capacity, so a steady-state rebuild doesn't allocate
+    itemX.clear();
+    itemY.clear();
+    itemRadius.clear();
+    itemCell.clear();
+    oversized.clear();
+    maxRadius = 0.0f;
+}
+
+int SpatialGrid::insert(float x, float y, float radius) {
+    int item = static_cast<int>(itemX.size());
+    itemX.push_back(x);
+    itemY.push_back(y);
+    itemRadius.push_back(radius);
+
+    if (radius > cellSize * 0.5f) {
+        itemCell.push_back(-1);
+        oversized.push_back(item);
+    } else {
+        itemCell.push_back(rowAt(y) * columns + columnAt(x));
+        maxRadius = std::max(maxRadius, radius);
+    }
+    return item;
+}
+
+void SpatialGrid::build() {
+    // Counting sort: histogram, prefix sum, scatter. Items within a cell stay
+    // in insertion order.
+    int cellCount = columns * rows;
+    std::fill(cellStart.begin(), cellStart.end(), 0);
+    for (int cell : itemCell) {
+        if (cell >= 0) {
+            cellStart[cell + 1]++;
+        }
+    }
+    for (int cell = 0; cell < cellCount; cell++) {
+        cellStart[cell + 1] += cellStart[cell];
+    }
+
+    int bucketed = cellStart[cellCount];
+    sortedItem.resize(bucketed);
+    sortedX.resize(bucketed);
+    sortedY.resize(bucketed);
+    sortedRadius.resize(bucketed);
+
+    std::copy(cellStart.begin(), cellStart.end() - 1, cellCursor.begin());
+    for (int item = 0; item < size(); item++) {
+        int cell = itemCell[item];
+        if (cell < 0) continue;
+        int slot = cellCursor[cell]++;
+        sortedItem[slot] = item;
+        sortedX[slot] = itemX[item];
+        sortedY[slot] = itemY[item];
+        sortedRadius[slot] = itemRadius[item];
+    }
+}
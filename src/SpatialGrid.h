@@ -0,0 +1,137 @@
+#pragma once
+#include <vector>
+#include <algorithm>
+#include "Collision.h"
+
+// Uniform grid broadphase for circles over a fixed-size arena.
+// Rebuilt from scratch every tick: insert() every circle, build() buckets them
+// with a counting sort, then query() only visits the cells a query circle can
+// reach and tests candidates with squared distances. Items are identified by
+// their insertion index, so the caller keeps its own index -> object table.
+// Fast movers use querySwept(), which tests the whole segment a circle covers
+// during the tick instead of only where it ends up.
+//
+// Circles wider than half a cell (bosses) are kept in a short side list that
+// every query scans, so one large item doesn't widen the search for all others.
+// Items outside the arena are clamped into the border cells; queries clamp the
+// same way, so nothing is missed.
+class SpatialGrid {
+public:
+    SpatialGrid(float worldWidth, float worldHeight, float cellSize);
+
+    void clear();
+    // Returns the item's index
+    int insert(float x, float y, float radius);
+    // Call after the last insert() and before querying
+    void build();
+
+    // Calls fn(index) for every item whose circle overlaps the query circle
+    template <typename Fn>
+    void query(float x, float y, float radius, Fn&& fn) const {
+        forEachCandidate(x - radius, y - radius, x + radius, y + radius,
+                         [&](int item, float centerX, float centerY, float itemRange) {
+            float dx = centerX - x;
+            float dy = centerY - y;
+            float range = radius + itemRange;
+            if (dx * dx + dy * dy < range * range) {
+                fn(item);
+            }
+        });
+    }
+
+    // Calls fn(index, t) for every item touched by a circle moving from
+    // (x0, y0) to (x1, y1); t in [0, 1] is when along the move it first touches
+    template <typename Fn>
+    void querySwept(float x0, float y0, float x1, float y1, float radius, Fn&& fn) const {
+        forEachCandidate(std::min(x0, x1) - radius, std::min(y0, y1) - radius,
+                         std::max(x0, x1) + radius, std::max(y0, y1) + radius,
+                         [&](int item, float centerX, float centerY, float itemRange) {
+            float t = sweepCircle(x0, y0, x1, y1, radius + itemRange, centerX, centerY);
+            if (t >= 0.0f) {
+                fn(item, t);
+            }
+        });
+    }
+
+    // Lowest-index overlapping item for which accept(index) is true, or -1.
+    // Matches what a linear scan in insertion order would have hit first.
+    template <typename Fn>
+    int queryFirst(float x, float y, float radius, Fn&& accept) const {
+        int best = -1;
+        query(x, y, radius, [&](int item) {
+            if ((best < 0 || item < best) && accept(item)) {
+                best = item;
+            }
+        });
+        return best;
+    }
+
+    // Earliest item along the move for which accept(index) is true, or -1.
+    // Ties (e.g. several overlapping at the start) go to the lowest index.
+    template <typename Fn>
+    int querySweptFirst(float x0, float y0, float x1, float y1, float radius, float& hitTime, Fn&& accept) const {
+        int best = -1;
+        float bestTime = 2.0f;
+        querySwept(x0, y0, x1, y1, radius, [&](int item, float t) {
+            if ((t < bestTime || (t == bestTime && item < best)) && accept(item)) {
+                best = item;
+                bestTime = t;
+            }
+        });
+        hitTime = bestTime;
+        return best;
+    }
+
+    int size() const { return static_cast<int>(itemX.size()); }
+    int getColumns() const { return columns; }
+    int getRows() const { return rows; }
+    int getOversizedCount() const { return static_cast<int>(oversized.size()); }
+
+private:
+    // Calls fn(index, x, y, radius) for the items in every cell the box
+    // [left, right] x [top, bottom] can reach, then for the oversized items
+    template <typename Fn>
+    void forEachCandidate(float left, float top, float right, float bottom, Fn&& fn) const {
+        int minColumn = columnAt(left - maxRadius);
+        int maxColumn = columnAt(right + maxRadius);
+        int minRow = rowAt(top - maxRadius);
+        int maxRow = rowAt(bottom + maxRadius);
+
+        for (int row = minRow; row <= maxRow; row++) {
+            for (int column = minColumn; column <= maxColumn; column++) {
+                int cell = row * columns + column;
+                for (int slot = cellStart[cell]; slot < cellStart[cell + 1]; slot++) {
+                    fn(sortedItem[slot], sortedX[slot], sortedY[slot], sortedRadius[slot]);
+                }
+            }
+        }
+
+        for (int item : oversized) {
+            fn(item, itemX[item], itemY[item], itemRadius[item]);
+        }
+    }
+
+    int columnAt(float x) const;
+    int rowAt(float y) const;
+
+    float cellSize;
+    float inverseCellSize;
+    int columns;
+    int rows;
+    float maxRadius; // Largest radius among items stored in cells
+
+    // Items in insertion order
+    std::vector<float> itemX;
+    std::vector<float> itemY;
+    std::vector<float> itemRadius;
+    std::vector<int> itemCell; // -1 for oversized items
+
+    // Items sorted by cell: cell c owns slots [cellStart[c], cellStart[c + 1])
+    std::vector<int> cellStart;
+    std::vector<int> cellCursor;
+    std::vector<int> sortedItem;
+    std::vector<float> sortedX;
+    std::vector<float> sortedY;
+    std::vector<float> sortedRadius;
+    std::vector<int> oversized;
+};
@@ -0,0 +1,90 @@
+#include "SpawnQueue.h"
+#include "PickupPool.h"
+#include <algorithm>
+
+SpawnBuffer::Command& SpawnBuffer::push(Kind kind, Vector2 pos) {
+    commands.emplace_back();
+    Command& command = commands.back();
+    command.sourceId = sourceId;
+    command.sequence = sequence++;
+    command.kind = kind;
+    command.bulletType = BulletType::PISTOL;
+    command.enemyOwned = false;
+    command.position = pos;
+    command.damage = 0;
+    command.range = 0.0f;
+    command.speed = 0.0f;
+    command.experience = 0;
+    command.materials = 0;
+    return command;
+}
+
+void SpawnBuffer::spawnBullet(Vector2 pos, Vector2 dir, int damage, float range, float speed,
+                              BulletType type, bool enemyOwned) {
+    Command& command = push(Kind::BULLET, pos);
+    command.direction = dir;
+    command.damage = damage;
+    command.range = range;
+    command.speed = speed;
+    command.bulletType = type;
+    command.enemyOwned = enemyOwned;
+}
+
+void SpawnBuffer::spawnExperience(Vector2 pos, int expValue) {
+    push(Kind::EXPERIENCE, pos).experience = expValue;
+}
+
+void SpawnBuffer::spawnMaterial(Vector2 pos, int materialValue, int expValue) {
+    Command& command = push(Kind::MATERIAL, pos);
+    command.materials = materialValue;
+    command.experience = expValue;
+}
+
+void SpawnQueue::setThreadCount(int count) {
+    buffers.resize(std::max(1, count));
+    for (auto& buffer : buffers) {
+        buffer.commands.reserve(256);
+    }
+}
+
+int SpawnQueue::flush(BulletPool& bullets, PickupPool& pickups, int maxMaterialsOnMap) {
+    merged.clear();
+    for (auto& buffer : buffers) {
+        merged.insert(merged.end(), buffer.commands.begin(), buffer.commands.end());
+        buffer.commands.clear();
+    }
+    if (merged.empty()) return 0;
+
+    // Each source records on a single thread, so (source, sequence) is unique
+    std::sort(merged.begin(), merged.end(), [](const SpawnBuffer::Command& a, const SpawnBuffer::Command& b) {
+        return a.sourceId != b.sourceId ? a.sourceId < b.sourceId : a.sequence < b.sequence;
+    });
+
+    int overflowMaterials = 0;
+    for (const auto& command : merged) {
+        switch (command.kind) {
+            case SpawnBuffer::Kind::BULLET:
+                bullets.spawn(command.position, command.direction, command.damage, command.range, command.speed,
+                              command.bulletType, command.enemyOwned);
+                break;
+            case SpawnBuffer::Kind::EXPERIENCE:
+                pickups.spawnExperience(command.position, command.experience);
+                break;
+            case SpawnBuffer::Kind::MATERIAL:
+                if (pickups.getMaterialCount() < maxMaterialsOnMap) {
+                    pickups.spawnMaterial(command.position, command.materials, command.experience);
+                } else {
+                    overflowMaterials += command.materials;
+                }
+                break;
+        }
+    }
+    return overflowMaterials;
+}
+
+void SpawnQueue::clear() {
+    for (auto& buffer : buffers) {
+        buffer.commands.clear();
+    }
+    merged.clear();
+}
@@ -0,0 +1,76 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+#include "Vector2.h"
+#include "BulletPool.h"
+
+class PickupPool;
+
+// Spawns recorded by one thread during a parallel phase.
+// Whoever spawns calls beginSource() with its stable id (EnemyStore ids) first;
+// commands are numbered per source so the merge can order them.
+class SpawnBuffer {
+public:
+    void beginSource(uint32_t id) {
+        sourceId = id;
+        sequence = 0;
+    }
+
+    // Same parameters as BulletPool::spawn
+    void spawnBullet(Vector2 pos, Vector2 dir, int damage = 10, float range = 200.0f, float speed = 400.0f,
+                     BulletType type = BulletType::PISTOL, bool enemyOwned = false);
+    void spawnExperience(Vector2 pos, int expValue = 1);
+    void spawnMaterial(Vector2 pos, int materialValue = 1, int expValue = 1);
+
+    bool empty() const { return commands.empty(); }
+
+private:
+    friend class SpawnQueue;
+
+    enum class Kind : uint8_t {
+        BULLET,
+        EXPERIENCE,
+        MATERIAL
+    };
+
+    struct Command {
+        uint32_t sourceId;
+        uint32_t sequence;
+        Kind kind;
+        BulletType bulletType;
+        bool enemyOwned;
+        Vector2 position;
+        Vector2 direction;
+        int damage;   // Bullets
+        float range;
+        float speed;
+        int experience; // Pickups
+        int materials;
+    };
+
+    Command& push(Kind kind, Vector2 pos);
+
+    std::vector<Command> commands;
+    uint32_t sourceId = 0;
+    uint32_t sequence = 0;
+};
+
+// One SpawnBuffer per job-system thread, so a parallel phase can spawn
+// without locks. flush() at the sync point after the phase applies every
+// command ordered by (source id, sequence): the same spawns land in the same
+// pool slots whatever the thread count or scheduling was.
+class SpawnQueue {
+public:
+    // One buffer per thread index (JobSystem::getThreadCount())
+    void setThreadCount(int count);
+    SpawnBuffer& forThread(int index) { return buffers[index]; }
+
+    // Applies and clears every buffer. Materials that would exceed
+    // maxMaterialsOnMap aren't dropped; their value is returned instead.
+    int flush(BulletPool& bullets, PickupPool& pickups, int maxMaterialsOnMap);
+    void clear();
+
+private:
+    std::vector<SpawnBuffer> buffers;
+    std::vector<SpawnBuffer::Command> merged; // Reused across flushes
+};
@@ -0,0 +1,85 @@
+#include "SpriteAtlas.h"
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+std::unordered_map<std::string, SpriteAtlas::Entry>& SpriteAtlas::entries() {
+    static std::unordered_map<std::string, Entry> table;
+    return table;
+}
+
+std::vector<std::string>& SpriteAtlas::pagePaths() {
+    static std::vector<std::string> pages;
+    return pages;
+}
+
+bool SpriteAtlas::load(const std::string& metadataPath) {
+    clear();
+
+    std::ifstream file(metadataPath);
+    if (!file) {
+        std::cout << "No sprite atlas at " << metadataPath << " - loading sprites individually" << std::endl;
+        return false;
+    }
+
+    // Page files are stored relative to the metadata file
+    std::string directory;
+    size_t slash = metadataPath.find_last_of("/\\");
+    if (slash != std::string::npos) {
+        directory = metadataPath.substr(0, slash + 1);
+    }
+
+    auto& table = entries();
+    auto& pages = pagePaths();
+    std::string line;
+    while (std::getline(file, line)) {
+        if (line.empty() || line[0] == '#') continue;
+
+        // Tab separated, sprite keys may contain spaces
+        std::vector<std::string> fields;
+        std::stringstream stream(line);
+        std::string field;
+        while (std::getline(stream, field, '\t')) {
+            fields.push_back(field);
+        }
+
+        if (fields[0] == "page" && fields.size() >= 3) {
+            int index = std::stoi(fields[1]);
+            if (index >= static_cast<int>(pages.size())) {
+                pages.resize(index + 1);
+            }
+            pages[index] = directory + fields[2];
+        } else if (fields[0] == "sprite" && fields.size() >= 7) {
+            Entry entry;
+            entry.page = std::stoi(fields[2]);
+            entry.source = {std::stoi(fields[3]), std::stoi(fields[4]), std::stoi(fields[5]), std::stoi(fields[6])};
+            table[fields[1]] = entry;
+        }
+    }
+
+    std::cout << "Loaded sprite atlas: " << table.size() << " sprites on " << pages.size() << " page(s)" << std::endl;
+    return !table.empty();
+}
+
+Sprite SpriteAtlas::get(SDL_Renderer* renderer, const std::string& path, AssetPriority priority) {
+    Sprite sprite;
+
+    // The page is still streaming in, so trust the metadata rather than
+    // checking it loaded; a broken page shows up as missing sprites
+    auto& table = entries();
+    auto it = table.find(path);
+    if (it != table.end() && it->second.page < static_cast<int>(pagePaths().size())) {
+        sprite.page = TextureCache::load(renderer, pagePaths()[it->second.page], priority);
+        sprite.source = it->second.source;
+        return sprite;
+    }
+
+    // Not packed: use the standalone PNG, sized once it is uploaded
+    sprite.page = TextureCache::load(renderer, path, priority);
+    return sprite;
+}
+
+void SpriteAtlas::clear() {
+    entries().clear();
+    pagePaths().clear();
+}
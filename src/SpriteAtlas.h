@@ -0,0 +1,53 @@
+#pragma once
+#include <SDL2/SDL.h>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "TextureCache.h"
+
+// A drawable image: a sub-rect of a shared texture page. When the asset is
+// packed into the atlas `page` is the atlas page and `source` the sprite's
+// rect on it, otherwise it is the standalone PNG loaded through TextureCache
+// and `source` stays empty, meaning all of it. Pages stream in, so everything
+// reads as empty until the page has been uploaded.
+struct Sprite {
+    TextureHandle page;
+    SDL_Rect source = {0, 0, 0, 0};
+
+    SDL_Texture* texture() const { return page ? page->texture.load() : nullptr; }
+
+    // The rect to draw from, resolved against the page for standalone PNGs
+    SDL_Rect region() const {
+        if (source.w > 0 || !page || !page->texture.load()) return source;
+        return {0, 0, page->width.load(), page->height.load()};
+    }
+    int width() const { return region().w; }
+    int height() const { return region().h; }
+};
+
+// Runtime side of tools/AtlasPacker. Reads the packer's metadata table once
+// and resolves asset paths to atlas sub-rects, so sprites from the same page
+// can be drawn without switching textures.
+class SpriteAtlas {
+public:
+    // Loads the metadata table; the pages themselves are uploaded on first use.
+    // Returns false if there is no atlas, lookups then fall back to single PNGs.
+    static bool load(const std::string& metadataPath = "atlas/atlas.txt");
+
+    // Looks up an asset by the path it would be loaded from on disk. Returns at
+    // once; the page is queued on the AssetLoader at `priority` if it isn't
+    // cached yet.
+    static Sprite get(SDL_Renderer* renderer, const std::string& path,
+                      AssetPriority priority = AssetPriority::NORMAL);
+
+    static void clear();
+
+private:
+    struct Entry {
+        int page;
+        SDL_Rect source;
+    };
+
+    static std::unordered_map<std::string, Entry>& entries();
+    static std::vector<std::string>& pagePaths();
+};
@@ -0,0 +1,196 @@
+#include "Steering.h"
+#include <cmath>
+#include <cstring>
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#define STEERING_X86
+#include <immintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+#endif
+
+// MSVC accepts AVX2 intrinsics in any function; GCC and Clang need the
+// function itself compiled for AVX2
+#if defined(STEERING_X86) && !defined(_MSC_VER)
+#define STEERING_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+#define STEERING_TARGET_AVX2
+#endif
+
+void Steering::chase(float* positionX, float* positionY, float* velocityX, float* velocityY,
+                     const float* speed, int count, Vector2 target, float deltaTime) {
+    switch (current()) {
+        case Backend::AVX2:
+            chaseAvx2(positionX, positionY, velocityX, velocityY, speed, count, target, deltaTime);
+            break;
+        case Backend::SSE2:
+            chaseSse2(positionX, positionY, velocityX, velocityY, speed, count, target, deltaTime);
+            break;
+        default:
+            chaseScalar(positionX, positionY, velocityX, velocityY, speed, count, target, deltaTime);
+            break;
+    }
+}
+
+void Steering::chaseScalar(float* positionX, float* positionY, float* velocityX, float* velocityY,
+                           const float* speed, int count, Vector2 target, float deltaTime) {
+    for (int i = 0; i < count; i++) {
+        float dx = target.x - positionX[i];
+        float dy = target.y - positionY[i];
+        float len = std::sqrt(dx * dx + dy * dy);
+        float scale = len > 0.0f ? speed[i] / len : 0.0f;
+        velocityX[i] = dx * scale;
+        velocityY[i] = dy * scale;
+        positionX[i] += velocityX[i] * deltaTime;
+        positionY[i] += velocityY[i] * deltaTime;
+    }
+}
+
+#ifdef STEERING_X86
+
+void Steering::chaseSse2(float* positionX, float* positionY, float* velocityX, float* velocityY,
+                         const float* speed, int count, Vector2 target, float deltaTime) {
+    const __m128 tx = _mm_set1_ps(target.x);
+    const __m128 ty = _mm_set1_ps(target.y);
+    const __m128 dt = _mm_set1_ps(deltaTime);
+    const __m128 zero = _mm_setzero_ps();
+    int i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m128 px = _mm_loadu_ps(positionX + i);
+        __m128 py = _mm_loadu_ps(positionY + i);
+        __m128 dx = _mm_sub_ps(tx, px);
+        __m128 dy = _mm_sub_ps(ty, py);
+        __m128 len = _mm_sqrt_ps(_mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy)));
+        // Zero-length lanes divide by zero; the mask turns their scale into 0
+        __m128 scale = _mm_and_ps(_mm_div_ps(_mm_loadu_ps(speed + i), len), _mm_cmpgt_ps(len, zero));
+        __m128 vx = _mm_mul_ps(dx, scale);
+        __m128 vy = _mm_mul_ps(dy, scale);
+        _mm_storeu_ps(velocityX + i, vx);
+        _mm_storeu_ps(velocityY + i, vy);
+        _mm_storeu_ps(positionX + i, _mm_add_ps(px, _mm_mul_ps(vx, dt)));
+        _mm_storeu_ps(positionY + i, _mm_add_ps(py, _mm_mul_ps(vy, dt)));
+    }
+    chaseScalar(positionX + i, positionY + i, velocityX + i, velocityY + i, speed + i, count - i, target, deltaTime);
+}
+
+STEERING_TARGET_AVX2
+void Steering::chaseAvx2(float* positionX, float* positionY, float* velocityX, float* velocityY,
+                         const float* speed, int count, Vector2 target, float deltaTime) {
+    const __m256 tx = _mm256_set1_ps(target.x);
+    const __m256 ty = _mm256_set1_ps(target.y);
+    const __m256 dt = _mm256_set1_ps(deltaTime);
+    const __m256 zero = _mm256_setzero_ps();
+    int i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m256 px = _mm256_loadu_ps(positionX + i);
+        __m256 py = _mm256_loadu_ps(positionY + i);
+        __m256 dx = _mm256_sub_ps(tx, px);
+        __m256 dy = _mm256_sub_ps(ty, py);
+        __m256 len = _mm256_sqrt_ps(_mm256_add_ps(_mm256_mul_ps(dx, dx), _mm256_mul_ps(dy, dy)));
+        __m256 scale = _mm256_and_ps(_mm256_div_ps(_mm256_loadu_ps(speed + i), len),
+                                     _mm256_cmp_ps(len, zero, _CMP_GT_OQ));
+        __m256 vx = _mm256_mul_ps(dx, scale);
+        __m256 vy = _mm256_mul_ps(dy, scale);
+        _mm256_storeu_ps(velocityX + i, vx);
+        _mm256_storeu_ps(velocityY + i, vy);
+        _mm256_storeu_ps(positionX + i, _mm256_add_ps(px, _mm256_mul_ps(vx, dt)));
+        _mm256_storeu_ps(positionY + i, _mm256_add_ps(py, _mm256_mul_ps(vy, dt)));
+    }
+    // Leave the upper YMM halves clean before falling back to SSE/scalar code
+    _mm256_zeroupper();
+    chaseScalar(positionX + i, positionY + i, velocityX + i, velocityY + i, speed + i, count - i, target, deltaTime);
+}
+
+#else
+
+// Not x86: only the scalar kernel exists, isSupported() never reports the others
+void Steering::chaseSse2(float* positionX, float* positionY, float* velocityX, float* velocityY,
+                         const float* speed, int count, Vector2 target, float deltaTime) {
+    chaseScalar(positionX, positionY, velocityX, velocityY, speed, count, target, deltaTime);
+}
+
+void Steering::chaseAvx2(float* positionX, float* positionY, float* velocityX, float* velocityY,
+                         const float* speed, int count, Vector2 target, float deltaTime) {
+    chaseScalar(positionX, positionY, velocityX, velocityY, speed, count, target, deltaTime);
+}
+
+#endif
+
+Steering::Backend Steering::detect() {
+#if defined(STEERING_X86) && defined(_MSC_VER)
+    // AVX2 needs the CPUID bit and the OS saving YMM state (OSXSAVE + XCR0)
+    int info[4];
+    __cpuid(info, 0);
+    if (info[0] >= 7) {
+        __cpuid(info, 1);
+        bool osxsave = (info[2] & (1 << 27)) != 0;
+        bool avx = (info[2] & (1 << 28)) != 0;
+        if (osxsave && avx && (_xgetbv(0) & 0x6) == 0x6) {
+            __cpuidex(info, 7, 0);
+            if (info[1] & (1 << 5)) {
+                return Backend::AVX2;
+            }
+        }
+    }
+    return Backend::SSE2; // Baseline for every x64 Windows build
+#elif defined(STEERING_X86)
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) {
+        return Backend::AVX2;
+    }
+    if (__builtin_cpu_supports("sse2")) {
+        return Backend::SSE2;
+    }
+    return Backend::SCALAR;
+#else
+    return Backend::SCALAR;
+#endif
+}
+
+Steering::Backend& Steering::current() {
+    static Backend backend = detect();
+    return backend;
+}
+
+Steering::Backend Steering::getBackend() {
+    return current();
+}
+
+const char* Steering::getBackendName() {
+    switch (current()) {
+        case Backend::AVX2: return "avx2";
+        case Backend::SSE2: return "sse2";
+        default: return "scalar";
+    }
+}
+
+bool Steering::isSupported(Backend backend) {
+    switch (backend) {
+        case Backend::SCALAR: return true;
+        case Backend::SSE2: return detect() != Backend::SCALAR;
+        case Backend::AVX2: return detect() == Backend::AVX2;
+    }
+    return false;
+}
+
+bool Steering::setBackend(Backend backend) {
+    if (!isSupported(backend)) {
+        return false;
+    }
+    current() = backend;
+    return true;
+}
+
+bool Steering::parseBackend(const char* name, Backend& backend) {
+    if (std::strcmp(name, "scalar") == 0) {
+        backend = Backend::SCALAR;
+    } else if (std::strcmp(name, "sse2") == 0) {
+        backend = Backend::SSE2;
+    } else if (std::strcmp(name, "avx2") == 0) {
+        backend = Backend::AVX2;
+    } else {
+        return false;
+    }
+    return true;
+}
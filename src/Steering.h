@@ -0,0 +1,46 @@
+#pragma once
+#include "Vector2.h"
+
+// Batch chase steering: every agent turns straight toward `target` at its own
+// speed and takes one step. Operates on structure-of-arrays data (EnemyStore
+// groups).
+//
+// The AVX2, SSE2 and scalar implementations live in one binary; the best one
+// the CPU supports is picked on first use, and setBackend() can force another
+// (--simd on the command line). All three produce bit-for-bit identical
+// results: they run the same IEEE operations (sqrt, divide, multiply, add)
+// in the same order, and Steering.cpp is built with floating-point contraction
+// off so the compiler can't fuse the scalar multiply-adds into FMAs.
+class Steering {
+public:
+    enum class Backend {
+        SCALAR,
+        SSE2,
+        AVX2
+    };
+
+    // velocity = normalize(target - position) * speed; position += velocity * deltaTime.
+    // Agents already at the target get zero velocity.
+    static void chase(float* positionX, float* positionY, float* velocityX, float* velocityY,
+                      const float* speed, int count, Vector2 target, float deltaTime);
+
+    static Backend getBackend();
+    static const char* getBackendName();
+    static bool isSupported(Backend backend);
+    // Returns false (and keeps the current backend) if the CPU lacks it
+    static bool setBackend(Backend backend);
+    // "scalar", "sse2" or "avx2"
+    static bool parseBackend(const char* name, Backend& backend);
+
+    // Individual implementations, for benchmarks. Only call supported ones.
+    static void chaseScalar(float* positionX, float* positionY, float* velocityX, float* velocityY,
+                            const float* speed, int count, Vector2 target, float deltaTime);
+    static void chaseSse2(float* positionX, float* positionY, float* velocityX, float* velocityY,
+                          const float* speed, int count, Vector2 target, float deltaTime);
+    static void chaseAvx2(float* positionX, float* positionY, float* velocityX, float* velocityY,
+                          const float* speed, int count, Vector2 target, float deltaTime);
+
+private:
+    static Backend& current();
+    static Backend detect();
+};
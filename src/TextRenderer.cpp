@@ -0,0 +1,351 @@
+#include "TextRenderer.h"
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+
+GlyphAtlas::~GlyphAtlas() {
+    if (page) {
+        SDL_DestroyTexture(page);
+        page = nullptr;
+    }
+    if (font) {
+        TTF_CloseFont(font);
+        font = nullptr;
+    }
+}
+
+TextRenderer::AtlasMap& TextRenderer::atlases() {
+    static AtlasMap cache;
+    return cache;
+}
+
+int TextRenderer::glyphIndex(char c) {
+    int code = static_cast<unsigned char>(c);
+    if (code < GlyphAtlas::FIRST_GLYPH || code > GlyphAtlas::LAST_GLYPH) {
+        code = '?';
+    }
+    return code - GlyphAtlas::FIRST_GLYPH;
+}
+
+std::mutex& TextRenderer::ttfMutex() {
+    static std::mutex mutex;
+    return mutex;
+}
+
+GlyphAtlas* TextRenderer::getAtlas(SDL_Renderer* renderer, const std::string& fontPath, int fontSize) {
+    if (fontPath.empty() || fontSize <= 0) return nullptr;
+
+    auto& cache = atlases();
+    auto it = cache.find(AtlasLookup(fontPath, fontSize));
+    if (it != cache.end()) {
+        // No page yet while a streamed atlas is still on its way
+        GlyphAtlas* atlas = it->second.get();
+        return (atlas && atlas->page) ? atlas : nullptr;
+    }
+
+    // Failures are cached as null so a missing font isn't reopened every frame
+    std::unique_ptr<GlyphAtlas> atlas = bake(renderer, fontPath, fontSize);
+    GlyphAtlas* result = atlas.get();
+    cache[AtlasKey(fontPath, fontSize)] = std::move(atlas);
+    return result;
+}
+
+std::unique_ptr<GlyphAtlas> TextRenderer::bake(SDL_Renderer* renderer, const std::string& fontPath, int fontSize) {
+    std::unique_ptr<GlyphAtlas> atlas(new GlyphAtlas());
+    SDL_Surface* pageSurface = rasterize(*atlas, fontPath, fontSize);
+    if (!uploadPage(renderer, *atlas, pageSurface, fontPath, fontSize)) {
+        return nullptr;
+    }
+    return atlas;
+}
+
+SDL_Surface* TextRenderer::rasterize(GlyphAtlas& atlas, const std::string& fontPath, int fontSize) {
+    std::lock_guard<std::mutex> lock(ttfMutex());
+
+    TTF_Font* font = TTF_OpenFont(fontPath.c_str(), fontSize);
+    if (!font) {
+        return nullptr;
+    }
+
+    atlas.font = font;
+    atlas.lineSkip = TTF_FontLineSkip(font);
+
+    // Rasterize every glyph first so the page can be sized to fit
+    const int pageWidth = 512;
+    const int padding = 1;
+    SDL_Color white = {255, 255, 255, 255};
+    SDL_Surface* glyphSurfaces[GlyphAtlas::GLYPH_COUNT] = {};
+    int penX = padding;
+    int penY = padding;
+    int rowHeight = 0;
+
+    for (int i = 0; i < GlyphAtlas::GLYPH_COUNT; i++) {
+        Uint32 ch = static_cast<Uint32>(GlyphAtlas::FIRST_GLYPH + i);
+        GlyphAtlas::Glyph& glyph = atlas.glyphs[i];
+
+        int minX = 0, maxX = 0, minY = 0, maxY = 0, advance = 0;
+        if (TTF_GlyphMetrics32(font, ch, &minX, &maxX, &minY, &maxY, &advance) == 0) {
+            glyph.advance = advance;
+            glyph.offsetX = std::min(0, minX);
+        }
+
+        if (ch == ' ') continue; // Nothing to draw, only the advance matters
+
+        SDL_Surface* surface = TTF_RenderGlyph32_Blended(font, ch, white);
+        if (!surface) continue;
+
+        if (penX + surface->w + padding > pageWidth) {
+            penX = padding;
+            penY += rowHeight + padding;
+            rowHeight = 0;
+        }
+        glyph.source = {penX, penY, surface->w, surface->h};
+        penX += surface->w + padding;
+        rowHeight = std::max(rowHeight, surface->h);
+        glyphSurfaces[i] = surface;
+    }
+    int pageHeight = penY + rowHeight + padding;
+
+    SDL_Surface* pageSurface = SDL_CreateRGBSurfaceWithFormat(0, pageWidth, pageHeight, 32, SDL_PIXELFORMAT_RGBA32);
+    if (pageSurface) {
+        SDL_FillRect(pageSurface, nullptr, SDL_MapRGBA(pageSurface->format, 0, 0, 0, 0));
+        for (int i = 0; i < GlyphAtlas::GLYPH_COUNT; i++) {
+            if (!glyphSurfaces[i]) continue;
+            // Copy coverage straight into the page instead of blending onto it
+            SDL_SetSurfaceBlendMode(glyphSurfaces[i], SDL_BLENDMODE_NONE);
+            SDL_Rect dest = atlas.glyphs[i].source;
+            SDL_BlitSurface(glyphSurfaces[i], nullptr, pageSurface, &dest);
+        }
+        atlas.pageWidth = pageWidth;
+        atlas.pageHeight = pageHeight;
+    } else {
+        std::cout << "Unable to create glyph page for " << fontPath << " (" << fontSize
+                  << "pt)! SDL Error: " << SDL_GetError() << std::endl;
+    }
+
+    for (SDL_Surface* surface : glyphSurfaces) {
+        if (surface) SDL_FreeSurface(surface);
+    }
+    return pageSurface;
+}
+
+bool TextRenderer::uploadPage(SDL_Renderer* renderer, GlyphAtlas& atlas, SDL_Surface* pageSurface,
+                              const std::string& fontPath, int fontSize) {
+    if (!pageSurface) return false;
+
+    atlas.page = SDL_CreateTextureFromSurface(renderer, pageSurface);
+    SDL_FreeSurface(pageSurface);
+
+    if (!atlas.page) {
+        std::cout << "Unable to create glyph atlas for " << fontPath << " (" << fontSize
+                  << "pt)! SDL Error: " << SDL_GetError() << std::endl;
+        return false;
+    }
+
+    SDL_SetTextureBlendMode(atlas.page, SDL_BLENDMODE_BLEND);
+    std::cout << "Baked glyph atlas: " << fontPath << " " << fontSize << "pt ("
+              << atlas.pageWidth << "x" << atlas.pageHeight << ")" << std::endl;
+    return true;
+}
+
+bool TextRenderer::preload(SDL_Renderer* renderer, const std::string& fontPath, int fontSize) {
+    return getAtlas(renderer, fontPath, fontSize) != nullptr;
+}
+
+std::shared_future<bool> TextRenderer::preloadAsync(SDL_Renderer* renderer, const std::string& fontPath,
+                                                    int fontSize, AssetPriority priority) {
+    auto& cache = atlases();
+    auto it = cache.find(AtlasLookup(fontPath, fontSize));
+    if (it != cache.end()) {
+        GlyphAtlas* existing = it->second.get();
+        if (existing && existing->loaded.valid()) {
+            return existing->loaded;
+        }
+        // Baked synchronously earlier (or failed): already settled
+        std::promise<bool> settled;
+        settled.set_value(existing && existing->page);
+        return settled.get_future().share();
+    }
+
+    // The map owns the atlas from here on; clear() must wait for
+    // AssetLoader::stop so the loader thread never writes into a freed one
+    std::unique_ptr<GlyphAtlas> atlas(new GlyphAtlas());
+    GlyphAtlas* target = atlas.get();
+    cache[AtlasKey(fontPath, fontSize)] = std::move(atlas);
+
+    auto decode = [target, fontPath, fontSize]() {
+        return rasterize(*target, fontPath, fontSize);
+    };
+    auto upload = [renderer, target, fontPath, fontSize](SDL_Surface* pageSurface) {
+        return uploadPage(renderer, *target, pageSurface, fontPath, fontSize);
+    };
+    target->loaded = AssetLoader::submit(priority, decode, upload);
+    return target->loaded;
+}
+
+bool TextRenderer::draw(SDL_Renderer* renderer, const std::string& fontPath, int fontSize,
+                        const char* text, int x, int y, SDL_Color color) {
+    GlyphAtlas* atlas = getAtlas(renderer, fontPath, fontSize);
+    if (!atlas) return false;
+    if (!text) return true;
+
+    atlas->vertices.clear();
+    atlas->indices.clear();
+
+    float pageW = static_cast<float>(atlas->pageWidth);
+    float pageH = static_cast<float>(atlas->pageHeight);
+
+    int penX = x;
+    int penY = y;
+    Uint32 previous = 0;
+    for (const char* c = text; *c; c++) {
+        if (*c == '\n') {
+            penX = x;
+            penY += atlas->lineSkip;
+            previous = 0;
+            continue;
+        }
+
+        int index = glyphIndex(*c);
+        Uint32 ch = static_cast<Uint32>(GlyphAtlas::FIRST_GLYPH + index);
+        if (previous) {
+            penX += TTF_GetFontKerningSizeGlyphs32(atlas->font, previous, ch);
+        }
+        previous = ch;
+
+        const GlyphAtlas::Glyph& glyph = atlas->glyphs[index];
+        if (glyph.source.w > 0 && glyph.source.h > 0) {
+            float left = static_cast<float>(penX + glyph.offsetX);
+            float top = static_cast<float>(penY);
+            float right = left + glyph.source.w;
+            float bottom = top + glyph.source.h;
+            float u0 = glyph.source.x / pageW;
+            float v0 = glyph.source.y / pageH;
+            float u1 = (glyph.source.x + glyph.source.w) / pageW;
+            float v1 = (glyph.source.y + glyph.source.h) / pageH;
+
+            int base = static_cast<int>(atlas->vertices.size());
+            atlas->vertices.push_back({{left, top}, color, {u0, v0}});
+            atlas->vertices.push_back({{right, top}, color, {u1, v0}});
+            atlas->vertices.push_back({{right, bottom}, color, {u1, v1}});
+            atlas->vertices.push_back({{left, bottom}, color, {u0, v1}});
+            atlas->indices.push_back(base);
+            atlas->indices.push_back(base + 1);
+            atlas->indices.push_back(base + 2);
+            atlas->indices.push_back(base);
+            atlas->indices.push_back(base + 2);
+            atlas->indices.push_back(base + 3);
+        }
+        penX += glyph.advance;
+    }
+
+    if (atlas->indices.empty()) return true;
+
+    int result = SDL_RenderGeometry(renderer, atlas->page,
+                                    atlas->vertices.data(), static_cast<int>(atlas->vertices.size()),
+                                    atlas->indices.data(), static_cast<int>(atlas->indices.size()));
+    if (result != 0) {
+        // Renderer without geometry support: copy glyph by glyph with a color mod
+        SDL_SetTextureColorMod(atlas->page, color.r, color.g, color.b);
+        SDL_SetTextureAlphaMod(atlas->page, color.a);
+        for (size_t v = 0; v < atlas->vertices.size(); v += 4) {
+            const SDL_Vertex& topLeft = atlas->vertices[v];
+            const SDL_Vertex& bottomRight = atlas->vertices[v + 2];
+            SDL_Rect src = {static_cast<int>(topLeft.tex_coord.x * pageW + 0.5f),
+                            static_cast<int>(topLeft.tex_coord.y * pageH + 0.5f),
+                            static_cast<int>(bottomRight.position.x - topLeft.position.x),
+                            static_cast<int>(bottomRight.position.y - topLeft.position.y)};
+            SDL_Rect dest = {static_cast<int>(topLeft.position.x), static_cast<int>(topLeft.position.y),
+                             src.w, src.h};
+            SDL_RenderCopy(renderer, atlas->page, &src, &dest);
+        }
+        SDL_SetTextureColorMod(atlas->page, 255, 255, 255);
+        SDL_SetTextureAlphaMod(atlas->page, 255);
+    }
+    return true;
+}
+
+int TextRenderer::measure(SDL_Renderer* renderer, const std::string& fontPath, int fontSize, const char* text) {
+    GlyphAtlas* atlas = getAtlas(renderer, fontPath, fontSize);
+    if (!atlas || !text) return 0;
+
+    int width = 0;
+    int lineWidth = 0;
+    Uint32 previous = 0;
+    for (const char* c = text; *c; c++) {
+        if (*c == '\n') {
+            width = std::max(width, lineWidth);
+            lineWidth = 0;
+            previous = 0;
+            continue;
+        }
+        int index = glyphIndex(*c);
+        Uint32 ch = static_cast<Uint32>(GlyphAtlas::FIRST_GLYPH + index);
+        if (previous) {
+            lineWidth += TTF_GetFontKerningSizeGlyphs32(atlas->font, previous, ch);
+        }
+        previous = ch;
+        lineWidth += atlas->glyphs[index].advance;
+    }
+    return std::max(width, lineWidth);
+}
+
+void TextRenderer::clear() {
+    atlases().clear();
+}
+
+int TextRenderer::getAtlasCount() {
+    int count = 0;
+    for (const auto& entry : atlases()) {
+        if (entry.second) count++;
+    }
+    return count;
+}
+
+void FontChooser::begin(SDL_Renderer* renderer, const std::vector<std::string>& paths,
+                        const std::vector<int>& sizes, AssetPriority priority) {
+    this->renderer = renderer;
+    this->priority = priority;
+    candidates = paths;
+    fontSizes = sizes;
+    next = 0;
+    requestNext();
+}
+
+void FontChooser::requestNext() {
+    pending.clear();
+    path.clear();
+    while (next < candidates.size()) {
+        const std::string& candidate = candidates[next++];
+
+        // Skip files that aren't there without a trip through the loader
+        SDL_RWops* file = SDL_RWFromFile(candidate.c_str(), "rb");
+        if (!file) continue;
+        SDL_RWclose(file);
+
+        path = candidate;
+        for (int fontSize : fontSizes) {
+            pending.push_back(TextRenderer::preloadAsync(renderer, path, fontSize, priority));
+        }
+        return;
+    }
+}
+
+bool FontChooser::update() {
+    if (pending.empty()) return false;
+
+    bool loaded = true;
+    for (const auto& future : pending) {
+        if (future.wait_for(std::chrono::seconds(0)) != std::future_status::ready) return false;
+        loaded = loaded && future.get();
+    }
+
+    if (loaded) {
+        pending.clear();
+        return true;
+    }
+
+    std::cout << "Font " << path << " could not be loaded, trying the next one" << std::endl;
+    requestNext();
+    return pending.empty();
+}
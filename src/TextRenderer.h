@@ -0,0 +1,126 @@
+#pragma once
+#include <SDL2/SDL.h>
+#include <SDL2/SDL_ttf.h>
+#include <future>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+#include "AssetLoader.h"
+
+// One font at one point size, baked once into a single texture page.
+// Printable ASCII (32..126) is rasterized white with TTF_RenderGlyph32_Blended;
+// text color is applied per vertex when drawing.
+struct GlyphAtlas {
+    static const int FIRST_GLYPH = 32;
+    static const int LAST_GLYPH = 126;
+    static const int GLYPH_COUNT = LAST_GLYPH - FIRST_GLYPH + 1;
+
+    struct Glyph {
+        SDL_Rect source;  // Region in the page texture (w/h 0 for empty glyphs)
+        int offsetX;      // Left bearing the glyph surface was shifted by
+        int advance;
+    };
+
+    TTF_Font* font = nullptr;
+    SDL_Texture* page = nullptr;
+    int pageWidth = 0;
+    int pageHeight = 0;
+    int lineSkip = 0;
+    Glyph glyphs[GLYPH_COUNT] = {};
+    std::shared_future<bool> loaded;  // Set for atlases baked through preloadAsync
+
+    // Reused between draws so laying out text doesn't allocate
+    std::vector<SDL_Vertex> vertices;
+    std::vector<int> indices;
+
+    ~GlyphAtlas();
+};
+
+// Process-wide text renderer. Each (font file, size) pair gets its own atlas
+// the first time it is used; after that drawing a string is one
+// SDL_RenderGeometry call with no surface or texture allocation.
+class TextRenderer {
+public:
+    // Bakes the atlas up front so the first frame using it doesn't hitch.
+    // Returns false if the font can't be opened (or is still streaming in).
+    static bool preload(SDL_Renderer* renderer, const std::string& fontPath, int fontSize);
+
+    // Rasterizes the glyphs on an AssetLoader thread and uploads the page in a
+    // later frame. Until then draw() returns false so callers use their fallback.
+    static std::shared_future<bool> preloadAsync(SDL_Renderer* renderer, const std::string& fontPath, int fontSize,
+                                                 AssetPriority priority = AssetPriority::NORMAL);
+
+    // Returns false (and draws nothing) if the font isn't available
+    static bool draw(SDL_Renderer* renderer, const std::string& fontPath, int fontSize,
+                     const char* text, int x, int y, SDL_Color color);
+
+    // Width in pixels the string would take, 0 if the font isn't available
+    static int measure(SDL_Renderer* renderer, const std::string& fontPath, int fontSize, const char* text);
+
+    // Destroys every atlas. Call after AssetLoader::stop, before TTF_Quit and
+    // before destroying the renderer.
+    static void clear();
+
+    static int getAtlasCount();
+
+private:
+    using AtlasKey = std::pair<std::string, int>;
+    // Non-owning form of AtlasKey, so looking an atlas up every draw doesn't copy the path
+    using AtlasLookup = std::pair<std::string_view, int>;
+
+    struct AtlasKeyLess {
+        using is_transparent = void;
+
+        template <typename A, typename B>
+        bool operator()(const A& a, const B& b) const {
+            if (a.second != b.second) return a.second < b.second;
+            return std::string_view(a.first) < std::string_view(b.first);
+        }
+    };
+
+    using AtlasMap = std::map<AtlasKey, std::unique_ptr<GlyphAtlas>, AtlasKeyLess>;
+
+    static AtlasMap& atlases();
+    static GlyphAtlas* getAtlas(SDL_Renderer* renderer, const std::string& fontPath, int fontSize);
+    static std::unique_ptr<GlyphAtlas> bake(SDL_Renderer* renderer, const std::string& fontPath, int fontSize);
+    // Opens the font and fills in everything but the page texture; any thread
+    static SDL_Surface* rasterize(GlyphAtlas& atlas, const std::string& fontPath, int fontSize);
+    // Turns the rasterized page into a texture and frees it; main thread only
+    static bool uploadPage(SDL_Renderer* renderer, GlyphAtlas& atlas, SDL_Surface* pageSurface,
+                           const std::string& fontPath, int fontSize);
+    // SDL_ttf shares one FreeType library between fonts, so only one thread opens and rasterizes at a time
+    static std::mutex& ttfMutex();
+    static int glyphIndex(char c);
+};
+
+// Streams in the first font of a preference list that actually loads.
+// Candidates that exist but fail to bake are skipped when their atlases
+// resolve, so a broken font doesn't leave text blank. Main thread only.
+class FontChooser {
+public:
+    void begin(SDL_Renderer* renderer, const std::vector<std::string>& paths,
+               const std::vector<int>& sizes, AssetPriority priority);
+
+    // Call once per frame. Returns true on the frame the choice settles,
+    // either on a font that loaded or with none left.
+    bool update();
+
+    // The candidate being loaded or the chosen font; empty when none loaded
+    const std::string& getPath() const { return path; }
+    bool isLoading() const { return !pending.empty(); }
+
+private:
+    void requestNext();
+
+    SDL_Renderer* renderer = nullptr;
+    std::vector<std::string> candidates;
+    std::vector<int> fontSizes;
+    AssetPriority priority = AssetPriority::NORMAL;
+    size_t next = 0;
+    std::string path;
+    std::vector<std::shared_future<bool>> pending;
+};
@@ -0,0 +1,87 @@
+#include "TextureCache.h"
+#include <SDL2/SDL_image.h>
+#include <iostream>
+
+CachedTexture::~CachedTexture() {
+    SDL_Texture* owned = texture.exchange(nullptr);
+    if (owned) {
+        SDL_DestroyTexture(owned);
+    }
+}
+
+std::unordered_map<std::string, TextureHandle>& TextureCache::entries() {
+    static std::unordered_map<std::string, TextureHandle> cache;
+    return cache;
+}
+
+std::mutex& TextureCache::entriesMutex() {
+    static std::mutex mutex;
+    return mutex;
+}
+
+TextureHandle TextureCache::load(SDL_Renderer* renderer, const std::string& path, AssetPriority priority) {
+    std::lock_guard<std::mutex> lock(entriesMutex());
+    auto& cache = entries();
+    auto it = cache.find(path);
+    if (it != cache.end()) {
+        return it->second;
+    }
+
+    TextureHandle handle = std::make_shared<CachedTexture>(path);
+
+    // Decode on a loader thread...
+    auto decode = [path]() -> SDL_Surface* {
+        SDL_Surface* surface = IMG_Load(path.c_str());
+        if (!surface) {
+            std::cout << "Unable to load image " << path << "! SDL_image Error: " << IMG_GetError() << std::endl;
+        }
+        return surface;
+    };
+
+    // ...and upload on the main thread. The request holds a reference, so
+    // releaseUnused() can't drop the entry while it is in flight.
+    auto upload = [renderer, handle](SDL_Surface* surface) -> bool {
+        if (!surface) return false;
+
+        int width = surface->w;
+        int height = surface->h;
+        SDL_Texture* texture = SDL_CreateTextureFromSurface(renderer, surface);
+        SDL_FreeSurface(surface);
+
+        if (!texture) {
+            std::cout << "Unable to create texture from " << handle->path << "! SDL Error: " << SDL_GetError() << std::endl;
+            return false;
+        }
+
+        handle->width = width;
+        handle->height = height;
+        handle->texture = texture;
+        return true;
+    };
+
+    handle->loaded = AssetLoader::submit(priority, decode, upload);
+    cache[path] = handle;
+    return handle;
+}
+
+void TextureCache::releaseUnused() {
+    std::lock_guard<std::mutex> lock(entriesMutex());
+    auto& cache = entries();
+    for (auto it = cache.begin(); it != cache.end();) {
+        if (it->second.use_count() == 1) {
+            it = cache.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+void TextureCache::clear() {
+    std::lock_guard<std::mutex> lock(entriesMutex());
+    entries().clear();
+}
+
+int TextureCache::getTextureCount() {
+    std::lock_guard<std::mutex> lock(entriesMutex());
+    return static_cast<int>(entries().size());
+}
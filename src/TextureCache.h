@@ -0,0 +1,58 @@
+#pragma once
+#include <SDL2/SDL.h>
+#include <atomic>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include "AssetLoader.h"
+
+// A texture loaded from disk and shared by everything that uses the same asset.
+// The PNG is decoded in the background, so `texture` stays null until the
+// AssetLoader has uploaded it, and for good when the file could not be loaded;
+// the failure is cached too so missing optional art is only looked up once.
+// `width` and `height` are set before `texture`, so a non-null texture means
+// they are valid.
+struct CachedTexture {
+    std::string path;
+    std::atomic<SDL_Texture*> texture;
+    std::atomic<int> width;
+    std::atomic<int> height;
+    std::shared_future<bool> loaded; // True once uploaded, false if loading failed
+
+    explicit CachedTexture(const std::string& assetPath)
+        : path(assetPath), texture(nullptr), width(0), height(0) {}
+    ~CachedTexture();
+
+    CachedTexture(const CachedTexture&) = delete;
+    CachedTexture& operator=(const CachedTexture&) = delete;
+};
+
+// Reference-counted handle: the SDL texture is destroyed when the cache and
+// every holder have let go of it
+using TextureHandle = std::shared_ptr<CachedTexture>;
+
+// Process-wide texture cache keyed by asset path.
+// The first request for a path queues the PNG on the AssetLoader and returns
+// at once; every later request (e.g. each enemy spawn) just copies the shared
+// handle. Safe to call from the simulation thread, since the texture itself
+// is only ever created on the main thread.
+class TextureCache {
+public:
+    static TextureHandle load(SDL_Renderer* renderer, const std::string& path,
+                              AssetPriority priority = AssetPriority::NORMAL);
+
+    // Drops textures nobody outside the cache holds anymore
+    static void releaseUnused();
+
+    // Drops the cache's own references. Call before destroying the renderer,
+    // after entities holding handles have been released.
+    static void clear();
+
+    static int getTextureCount();
+
+private:
+    static std::unordered_map<std::string, TextureHandle>& entries();
+    static std::mutex& entriesMutex();
+};
@@ -1,17 +1,45 @@
 #pragma once
+#include <cmath>
 
+// Header-only so every operator inlines into the hot loops without LTO.
+// Everything that doesn't need a square root is constexpr.
 struct Vector2 {
     float x, y;
     
-    Vector2() : x(0), y(0) {}
-    Vector2(float x, float y) : x(x), y(y) {}
+    constexpr Vector2() : x(0), y(0) {}
+    constexpr Vector2(float x, float y) : x(x), y(y) {}
     
-    Vector2 operator+(const Vector2& other) const;
-    Vector2 operator-(const Vector2& other) const;
-    Vector2 operator*(float scalar) const;
-    Vector2& operator+=(const Vector2& other);
+    constexpr Vector2 operator+(const Vector2& other) const { return Vector2(x + other.x, y + other.y); }
+    constexpr Vector2 operator-(const Vector2& other) const { return Vector2(x - other.x, y - other.y); }
+    constexpr Vector2 operator*(float scalar) const { return Vector2(x * scalar, y * scalar); }
+    constexpr Vector2& operator+=(const Vector2& other) {
+        x += other.x;
+        y += other.y;
+        return *this;
+    }
     
-    float length() const;
-    Vector2 normalized() const;
-    float distance(const Vector2& other) const;
-};
\ No newline at end of file
+    constexpr float dot(const Vector2& other) const { return x * other.x + y * other.y; }
+    constexpr float lengthSquared() const { return x * x + y * y; }
+    constexpr float distanceSquared(const Vector2& other) const { return (*this - other).lengthSquared(); }
+    constexpr Vector2 lerp(const Vector2& target, float t) const {
+        return Vector2(x + (target.x - x) * t, y + (target.y - y) * t);
+    }
+    
+    float length() const { return std::sqrt(lengthSquared()); }
+    float distance(const Vector2& other) const { return (*this - other).length(); }
+    
+    Vector2 normalized() const {
+        float len = length();
+        if (len == 0) return Vector2(0, 0);
+        return Vector2(x / len, y / len);
+    }
+    
+    // One reciprocal and two multiplies instead of two divides; may differ from
+    // normalized() in the last bit. Use where direction only steers movement.
+    Vector2 normalizedFast() const {
+        float lenSq = lengthSquared();
+        if (lenSq == 0) return Vector2(0, 0);
+        float inverseLength = 1.0f / std::sqrt(lenSq);
+        return Vector2(x * inverseLength, y * inverseLength);
+    }
+};
@@ -0,0 +1,204 @@
+#include "VectorMath.h"
+#include <cmath>
+
+#if defined(BROTATO_NO_SIMD)
+#define VECTORMATH_SCALAR
+#elif defined(__AVX__)
+#define VECTORMATH_AVX
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define VECTORMATH_SSE2
+#include <emmintrin.h>
+#else
+#define VECTORMATH_SCALAR
+#endif
+
+// --- Scalar reference ---
+
+void VectorMath::normalizeScalar(const float* x, const float* y, float* outX, float* outY, int count) {
+    for (int i = 0; i < count; i++) {
+        Vector2 unit = Vector2(x[i], y[i]).normalized();
+        outX[i] = unit.x;
+        outY[i] = unit.y;
+    }
+}
+
+void VectorMath::normalizeFastScalar(const float* x, const float* y, float* outX, float* outY, int count) {
+    for (int i = 0; i < count; i++) {
+        Vector2 unit = Vector2(x[i], y[i]).normalizedFast();
+        outX[i] = unit.x;
+        outY[i] = unit.y;
+    }
+}
+
+void VectorMath::distanceScalar(const float* x, const float* y, Vector2 point, float* out, int count) {
+    for (int i = 0; i < count; i++) {
+        float dx = x[i] - point.x;
+        float dy = y[i] - point.y;
+        out[i] = std::sqrt(dx * dx + dy * dy);
+    }
+}
+
+void VectorMath::distanceSquaredScalar(const float* x, const float* y, Vector2 point, float* out, int count) {
+    for (int i = 0; i < count; i++) {
+        float dx = x[i] - point.x;
+        float dy = y[i] - point.y;
+        out[i] = dx * dx + dy * dy;
+    }
+}
+
+// --- SIMD ---
+// Each kernel runs whole vectors with unaligned loads, then hands the tail
+// (fewer than one vector's worth) to the scalar loop.
+
+#if defined(VECTORMATH_AVX)
+
+const char* VectorMath::getBackendName() {
+    return "AVX";
+}
+
+void VectorMath::normalize(const float* x, const float* y, float* outX, float* outY, int count) {
+    const __m256 zero = _mm256_setzero_ps();
+    int i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m256 vx = _mm256_loadu_ps(x + i);
+        __m256 vy = _mm256_loadu_ps(y + i);
+        __m256 length = _mm256_sqrt_ps(_mm256_add_ps(_mm256_mul_ps(vx, vx), _mm256_mul_ps(vy, vy)));
+        // Lanes with zero length divide by zero; the mask replaces them with 0
+        __m256 nonZero = _mm256_cmp_ps(length, zero, _CMP_NEQ_OQ);
+        _mm256_storeu_ps(outX + i, _mm256_and_ps(_mm256_div_ps(vx, length), nonZero));
+        _mm256_storeu_ps(outY + i, _mm256_and_ps(_mm256_div_ps(vy, length), nonZero));
+    }
+    normalizeScalar(x + i, y + i, outX + i, outY + i, count - i);
+}
+
+void VectorMath::normalizeFast(const float* x, const float* y, float* outX, float* outY, int count) {
+    const __m256 zero = _mm256_setzero_ps();
+    const __m256 half = _mm256_set1_ps(0.5f);
+    const __m256 threeHalves = _mm256_set1_ps(1.5f);
+    int i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m256 vx = _mm256_loadu_ps(x + i);
+        __m256 vy = _mm256_loadu_ps(y + i);
+        __m256 lengthSq = _mm256_add_ps(_mm256_mul_ps(vx, vx), _mm256_mul_ps(vy, vy));
+        __m256 r = _mm256_rsqrt_ps(lengthSq);
+        // Newton step: r' = r * (1.5 - 0.5 * l * r * r)
+        r = _mm256_mul_ps(r, _mm256_sub_ps(threeHalves, _mm256_mul_ps(_mm256_mul_ps(half, lengthSq), _mm256_mul_ps(r, r))));
+        __m256 nonZero = _mm256_cmp_ps(lengthSq, zero, _CMP_NEQ_OQ);
+        _mm256_storeu_ps(outX + i, _mm256_and_ps(_mm256_mul_ps(vx, r), nonZero));
+        _mm256_storeu_ps(outY + i, _mm256_and_ps(_mm256_mul_ps(vy, r), nonZero));
+    }
+    normalizeFastScalar(x + i, y + i, outX + i, outY + i, count - i);
+}
+
+void VectorMath::distanceSquared(const float* x, const float* y, Vector2 point, float* out, int count) {
+    const __m256 px = _mm256_set1_ps(point.x);
+    const __m256 py = _mm256_set1_ps(point.y);
+    int i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m256 dx = _mm256_sub_ps(_mm256_loadu_ps(x + i), px);
+        __m256 dy = _mm256_sub_ps(_mm256_loadu_ps(y + i), py);
+        _mm256_storeu_ps(out + i, _mm256_add_ps(_mm256_mul_ps(dx, dx), _mm256_mul_ps(dy, dy)));
+    }
+    distanceSquaredScalar(x + i, y + i, point, out + i, count - i);
+}
+
+void VectorMath::distance(const float* x, const float* y, Vector2 point, float* out, int count) {
+    const __m256 px = _mm256_set1_ps(point.x);
+    const __m256 py = _mm256_set1_ps(point.y);
+    int i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m256 dx = _mm256_sub_ps(_mm256_loadu_ps(x + i), px);
+        __m256 dy = _mm256_sub_ps(_mm256_loadu_ps(y + i), py);
+        _mm256_storeu_ps(out + i, _mm256_sqrt_ps(_mm256_add_ps(_mm256_mul_ps(dx, dx), _mm256_mul_ps(dy, dy))));
+    }
+    distanceScalar(x + i, y + i, point, out + i, count - i);
+}
+
+#elif defined(VECTORMATH_SSE2)
+
+const char* VectorMath::getBackendName() {
+    return "SSE2";
+}
+
+void VectorMath::normalize(const float* x, const float* y, float* outX, float* outY, int count) {
+    const __m128 zero = _mm_setzero_ps();
+    int i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m128 vx = _mm_loadu_ps(x + i);
+        __m128 vy = _mm_loadu_ps(y + i);
+        __m128 length = _mm_sqrt_ps(_mm_add_ps(_mm_mul_ps(vx, vx), _mm_mul_ps(vy, vy)));
+        // Lanes with zero length divide by zero; the mask replaces them with 0
+        __m128 nonZero = _mm_cmpneq_ps(length, zero);
+        _mm_storeu_ps(outX + i, _mm_and_ps(_mm_div_ps(vx, length), nonZero));
+        _mm_storeu_ps(outY + i, _mm_and_ps(_mm_div_ps(vy, length), nonZero));
+    }
+    normalizeScalar(x + i, y + i, outX + i, outY + i, count - i);
+}
+
+void VectorMath::normalizeFast(const float* x, const float* y, float* outX, float* outY, int count) {
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 half = _mm_set1_ps(0.5f);
+    const __m128 threeHalves = _mm_set1_ps(1.5f);
+    int i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m128 vx = _mm_loadu_ps(x + i);
+        __m128 vy = _mm_loadu_ps(y + i);
+        __m128 lengthSq = _mm_add_ps(_mm_mul_ps(vx, vx), _mm_mul_ps(vy, vy));
+        __m128 r = _mm_rsqrt_ps(lengthSq);
+        // Newton step: r' = r * (1.5 - 0.5 * l * r * r)
+        r = _mm_mul_ps(r, _mm_sub_ps(threeHalves, _mm_mul_ps(_mm_mul_ps(half, lengthSq), _mm_mul_ps(r, r))));
+        __m128 nonZero = _mm_cmpneq_ps(lengthSq, zero);
+        _mm_storeu_ps(outX + i, _mm_and_ps(_mm_mul_ps(vx, r), nonZero));
+        _mm_storeu_ps(outY + i, _mm_and_ps(_mm_mul_ps(vy, r), nonZero));
+    }
+    normalizeFastScalar(x + i, y + i, outX + i, outY + i, count - i);
+}
+
+void VectorMath::distanceSquared(const float* x, const float* y, Vector2 point, float* out, int count) {
+    const __m128 px = _mm_set1_ps(point.x);
+    const __m128 py = _mm_set1_ps(point.y);
+    int i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m128 dx = _mm_sub_ps(_mm_loadu_ps(x + i), px);
+        __m128 dy = _mm_sub_ps(_mm_loadu_ps(y + i), py);
+        _mm_storeu_ps(out + i, _mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy)));
+    }
+    distanceSquaredScalar(x + i, y + i, point, out + i, count - i);
+}
+
+void VectorMath::distance(const float* x, const float* y, Vector2 point, float* out, int count) {
+    const __m128 px = _mm_set1_ps(point.x);
+    const __m128 py = _mm_set1_ps(point.y);
+    int i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m128 dx = _mm_sub_ps(_mm_loadu_ps(x + i), px);
+        __m128 dy = _mm_sub_ps(_mm_loadu_ps(y + i), py);
+        _mm_storeu_ps(out + i, _mm_sqrt_ps(_mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy))));
+    }
+    distanceScalar(x + i, y + i, point, out + i, count - i);
+}
+
+#else
+
+const char* VectorMath::getBackendName() {
+    return "scalar";
+}
+
+void VectorMath::normalize(const float* x, const float* y, float* outX, float* outY, int count) {
+    normalizeScalar(x, y, outX, outY, count);
+}
+
+void VectorMath::normalizeFast(const float* x, const float* y, float* outX, float* outY, int count) {
+    normalizeFastScalar(x, y, outX, outY, count);
+}
+
+void VectorMath::distance(const float* x, const float* y, Vector2 point, float* out, int count) {
+    distanceScalar(x, y, point, out, count);
+}
+
+void VectorMath::distanceSquared(const float* x, const float* y, Vector2 point, float* out, int count) {
+    distanceSquaredScalar(x, y, point, out, count);
+}
+
+#endif
@@ -0,0 +1,33 @@
+#pragma once
+#include "Vector2.h"
+
+// Batch vector math over structure-of-arrays positions (separate x and y
+// arrays, as BulletPool, PickupPool and EnemyStore keep them).
+// Compiled for the widest instruction set the build targets: AVX when the
+// compiler is told it may use it (/arch:AVX, -mavx), otherwise SSE2, which
+// every x64 build has; other targets, and builds defining BROTATO_NO_SIMD,
+// use the scalar loops. The *Scalar versions are always available as a
+// reference and for benchmarking.
+//
+// Outputs may alias inputs (e.g. normalizing in place).
+class VectorMath {
+public:
+    // Unit vectors; zero-length inputs give (0, 0). Bit-identical to
+    // Vector2::normalized() on every backend.
+    static void normalize(const float* x, const float* y, float* outX, float* outY, int count);
+    // Approximate reciprocal square root refined by one Newton step (about
+    // 22 bits of precision). For steering, not for anything that must match
+    // the scalar path exactly.
+    static void normalizeFast(const float* x, const float* y, float* outX, float* outY, int count);
+    // Distance / squared distance from `point` to every position
+    static void distance(const float* x, const float* y, Vector2 point, float* out, int count);
+    static void distanceSquared(const float* x, const float* y, Vector2 point, float* out, int count);
+
+    static void normalizeScalar(const float* x, const float* y, float* outX, float* outY, int count);
+    static void normalizeFastScalar(const float* x, const float* y, float* outX, float* outY, int count);
+    static void distanceScalar(const float* x, const float* y, Vector2 point, float* out, int count);
+    static void distanceSquaredScalar(const float* x, const float* y, Vector2 point, float* out, int count);
+
+    // "AVX", "SSE2" or "scalar"
+    static const char* getBackendName();
+};
@@ -4,12 +4,11 @@
 #include <cmath>
 #include <algorithm>
 #include <random>
-#include <SDL2/SDL_image.h>
 #include <iostream>
 
 Weapon::Weapon(WeaponType weaponType, WeaponTier weaponTier) 
     : type(weaponType), tier(weaponTier), timeSinceLastShot(0.0f), 
-      muzzleFlashTimer(0.0f), lastShotDirection(1, 0), weaponTexture(nullptr) {
+      muzzleFlashTimer(0.0f), lastShotDirection(1, 0) {
     
     // Initialize stats based on weapon type and tier
     switch (type) {
@@ -29,10 +28,7 @@ Weapon::Weapon(WeaponType weaponType, WeaponTier weaponTier)
 }
 
 Weapon::~Weapon() {
-    if (weaponTexture) {
-        SDL_DestroyTexture(weaponTexture);
-        weaponTexture = nullptr;
-    }
+    // Weapon sprite is shared through SpriteAtlas
 }
 
 void Weapon::initialize(SDL_Renderer* renderer) {
@@ -82,18 +78,7 @@ void Weapon::loadWeaponTexture(SDL_Renderer* renderer) {
             break;
     }
     
-    SDL_Surface* surface = IMG_Load(texturePath.c_str());
-    if (!surface) {
-        std::cout << "Failed to load weapon texture: " << texturePath << " - " << IMG_GetError() << std::endl;
-        return;
-    }
-    
-    weaponTexture = SDL_CreateTextureFromSurface(renderer, surface);
-    SDL_FreeSurface(surface);
-    
-    if (!weaponTexture) {
-        std::cout << "Failed to create weapon texture: " << SDL_GetError() << std::endl;
-    }
+    weaponTexture = SpriteAtlas::get(renderer, texturePath);
 }
 
 void Weapon::initializePistolStats() {
@@ -218,7 +203,7 @@ void Weapon::initializeShotgunStats() {
 
 void Weapon::update(float deltaTime, const Vector2& weaponPos, 
                    const Vector2& aimDirection,
-                   std::vector<std::unique_ptr<Bullet>>& bullets,
+                   BulletPool& bullets,
                    const Player& player) {
     
     timeSinceLastShot += deltaTime;
@@ -233,7 +218,7 @@ void Weapon::update(float deltaTime, const Vector2& weaponPos,
     }
 }
 
-void Weapon::render(SDL_Renderer* renderer, const Vector2& weaponPos, const Vector2& weaponDirection) {
+void Weapon::render(RenderQueue& queue, const Vector2& weaponPos, const Vector2& weaponDirection) {
     // Special rendering for melee weapons
     if (type == WeaponType::MELEE_STICK) {
         // Show weapon extending and retracting
@@ -241,7 +226,7 @@ void Weapon::render(SDL_Renderer* renderer, const Vector2& weaponPos, const Vect
             Vector2 weaponTip = getWeaponTipPosition(weaponPos, weaponDirection);
             
             // Draw the weapon as a thick line from player to current tip position
-            SDL_SetRenderDrawColor(renderer, 139, 69, 19, 255); // Brown color for stick
+            SDL_Color stickColor = {139, 69, 19, 255}; // Brown color for stick
             
             // Draw multiple lines to make it thicker
             for (int offset = -2; offset <= 2; offset++) {
@@ -249,13 +234,13 @@ void Weapon::render(SDL_Renderer* renderer, const Vector2& weaponPos, const Vect
                 Vector2 startPos = weaponPos + perpendicular * offset;
                 Vector2 endPos = weaponTip + perpendicular * offset;
                 
-                SDL_RenderDrawLine(renderer, 
-                                  (int)startPos.x, (int)startPos.y,
-                                  (int)endPos.x, (int)endPos.y);
+                queue.submitLine(RenderLayer::WEAPONS,
+                                 (int)startPos.x, (int)startPos.y,
+                                 (int)endPos.x, (int)endPos.y, stickColor);
             }
             
             // Draw the brick at the tip
-            SDL_SetRenderDrawColor(renderer, 160, 82, 45, 255); // Darker brown for brick
+            SDL_Color brickColor = {160, 82, 45, 255}; // Darker brown for brick
             int brickSize = 6;
             SDL_Rect brickRect = {
                 (int)weaponTip.x - brickSize/2,
@@ -263,7 +248,7 @@ void Weapon::render(SDL_Renderer* renderer, const Vector2& weaponPos, const Vect
                 brickSize,
                 brickSize
             };
-            SDL_RenderFillRect(renderer, &brickRect);
+            queue.submitRect(RenderLayer::WEAPONS, brickRect, brickColor, 1);
         }
         
         // Don't render the normal weapon texture for melee weapons during attack
@@ -272,24 +257,19 @@ void Weapon::render(SDL_Renderer* renderer, const Vector2& weaponPos, const Vect
         }
     }
     
-    if (!weaponTexture) {
+    if (!weaponTexture.texture()) {
         // Fallback to line rendering if no texture
-        SDL_SetRenderDrawColor(renderer, 150, 150, 150, 255);
         Vector2 weaponEnd = weaponPos + weaponDirection * 15;
-        SDL_RenderDrawLine(renderer, 
-                          (int)weaponPos.x, (int)weaponPos.y,
-                          (int)weaponEnd.x, (int)weaponEnd.y);
+        queue.submitLine(RenderLayer::WEAPONS,
+                         (int)weaponPos.x, (int)weaponPos.y,
+                         (int)weaponEnd.x, (int)weaponEnd.y, {150, 150, 150, 255});
         return;
     }
     
-    // Get texture dimensions
-    int textureWidth, textureHeight;
-    SDL_QueryTexture(weaponTexture, nullptr, nullptr, &textureWidth, &textureHeight);
-    
     // Scale down the weapon sprite to much smaller size
     float scale = 0.33f;
-    int scaledWidth = (int)(textureWidth * scale);
-    int scaledHeight = (int)(textureHeight * scale);
+    int scaledWidth = (int)(weaponTexture.width() * scale);
+    int scaledHeight = (int)(weaponTexture.height() * scale);
     
     // Calculate rotation angle in degrees using weapon direction
     double angle = atan2(weaponDirection.y, weaponDirection.x) * 180.0 / M_PI;
@@ -303,28 +283,20 @@ void Weapon::render(SDL_Renderer* renderer, const Vector2& weaponPos, const Vect
     };
     
     // Render rotated weapon sprite
-    SDL_RenderCopyEx(renderer, weaponTexture, nullptr, &destRect, angle, nullptr, SDL_FLIP_NONE);
+    queue.submitSprite(RenderLayer::WEAPONS, weaponTexture, destRect, angle);
     
     // Only show muzzle flash if this weapon just fired (timer > 0.05 means very recent)
     if (muzzleFlashTimer > 0.05f) {
-        SDL_SetRenderDrawColor(renderer, 255, 255, 100, 255);
-        
         Vector2 muzzlePos = weaponPos + weaponDirection * 15;
         
         // Flash circle - smaller and less intrusive
         int flashRadius = 4;
-        for (int x = -flashRadius; x <= flashRadius; x++) {
-            for (int y = -flashRadius; y <= flashRadius; y++) {
-                if (x*x + y*y <= flashRadius*flashRadius) {
-                    SDL_RenderDrawPoint(renderer, (int)muzzlePos.x + x, (int)muzzlePos.y + y);
-                }
-            }
-        }
+        queue.submitCircle(RenderLayer::WEAPONS, (int)muzzlePos.x, (int)muzzlePos.y, flashRadius, {255, 255, 100, 255}, 0, 255, 1);
     }
 }
 
 void Weapon::fire(const Vector2& weaponPos, const Vector2& direction, 
-                 std::vector<std::unique_ptr<Bullet>>& bullets,
+                 BulletPool& bullets,
                  const Player& player) {
     
     // Melee weapons don't create bullets - they will be handled by Game's melee collision detection
@@ -357,7 +329,7 @@ void Weapon::fire(const Vector2& weaponPos, const Vector2& direction,
             float pelletAngle = baseAngle + (spreadAngle * (i - 1) / 2.0f);
             Vector2 pelletDirection(cos(pelletAngle), sin(pelletAngle));
             
-            bullets.push_back(std::make_unique<Bullet>(weaponPos, pelletDirection, finalDamage, stats.range, 400.0f, BulletType::PISTOL));
+            bullets.spawn(weaponPos, pelletDirection, finalDamage, stats.range, 400.0f, BulletType::PISTOL);
         }
         return;
     }
@@ -388,7 +360,7 @@ void Weapon::fire(const Vector2& weaponPos, const Vector2& direction,
     
     // Create bullet with appropriate type from weapon position
     BulletType bulletType = (type == WeaponType::SMG) ? BulletType::SMG : BulletType::PISTOL;
-    bullets.push_back(std::make_unique<Bullet>(weaponPos, fireDirection, finalDamage, stats.range, 400.0f, bulletType));
+    bullets.spawn(weaponPos, fireDirection, finalDamage, stats.range, 400.0f, bulletType);
     
     // Special weapon effects
     if (type == WeaponType::PISTOL) {
@@ -3,7 +3,9 @@
 #include <vector>
 #include <memory>
 #include "Vector2.h"
-#include "Bullet.h"
+#include "BulletPool.h"
+#include "SpriteAtlas.h"
+#include "RenderQueue.h"
 
 class Enemy;
 class Player;
@@ -51,10 +53,10 @@ public:
     
     virtual void update(float deltaTime, const Vector2& weaponPos, 
                        const Vector2& aimDirection,
-                       std::vector<std::unique_ptr<Bullet>>& bullets,
+                       BulletPool& bullets,
                        const Player& player);
     
-    virtual void render(SDL_Renderer* renderer, const Vector2& weaponPos, const Vector2& weaponDirection);
+    virtual void render(RenderQueue& queue, const Vector2& weaponPos, const Vector2& weaponDirection);
     
     // Getters
     WeaponType getType() const { return type; }
@@ -73,7 +75,7 @@ public:
     
 protected:
     virtual void fire(const Vector2& weaponPos, const Vector2& direction, 
-                     std::vector<std::unique_ptr<Bullet>>& bullets,
+                     BulletPool& bullets,
                      const Player& player);
     
     // Initialize weapon stats based on type
@@ -92,6 +94,6 @@ protected:
     Vector2 lastShotDirection;
     
     // Sprite rendering
-    SDL_Texture* weaponTexture;
+    Sprite weaponTexture;
     void loadWeaponTexture(SDL_Renderer* renderer);
 };
\ No newline at end of file
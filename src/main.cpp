@@ -1,9 +1,42 @@
 #include "Game.h"
+#include "Steering.h"
 #include <iostream>
+#include <cstdlib>
+#include <cstring>
 
 int main(int argc, char* args[]) {
     Game game;
     
+    // Frame pacing: --fps <n>, --vsync, --uncapped (benchmarking)
+    FramePacer& pacer = game.getFramePacer();
+    for (int i = 1; i < argc; i++) {
+        if (std::strcmp(args[i], "--fps") == 0 && i + 1 < argc) {
+            pacer.setTargetFps(std::atoi(args[++i]));
+        } else if (std::strcmp(args[i], "--vsync") == 0) {
+            pacer.setVsync(true);
+        } else if (std::strcmp(args[i], "--uncapped") == 0) {
+            pacer.setUncapped(true);
+        } else if (std::strcmp(args[i], "--threads") == 0 && i + 1 < argc) {
+            // Worker threads besides the simulation thread; 0 runs every job inline
+            game.getJobSystem().setWorkerCount(std::atoi(args[++i]));
+        } else if (std::strcmp(args[i], "--no-sim-thread") == 0) {
+            // Simulate between frames on the main thread (profiler sees its zones)
+            game.setSimulationThreaded(false);
+        } else if (std::strcmp(args[i], "--simd") == 0 && i + 1 < argc) {
+            // Force a steering kernel, e.g. to compare against scalar
+            Steering::Backend backend;
+            if (!Steering::parseBackend(args[++i], backend)) {
+                std::cout << "Unknown SIMD backend: " << args[i] << " (scalar, sse2, avx2)" << std::endl;
+            } else if (!Steering::setBackend(backend)) {
+                std::cout << "SIMD backend " << args[i] << " not supported by this CPU" << std::endl;
+            }
+        } else {
+            std::cout << "Unknown argument: " << args[i] << std::endl;
+        }
+    }
+    
+    std::cout << "Steering kernel: " << Steering::getBackendName() << std::endl;
+    
     if (!game.init()) {
         std::cout << "Failed to initialize game!" << std::endl;
         return -1;
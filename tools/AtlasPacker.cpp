@@ -0,0 +1,204 @@
+// Offline sprite atlas packer.
+//
+// Packs every PNG found under the given asset directories into one or more
+// atlas pages and writes a metadata table that SpriteAtlas loads at runtime:
+//
+//   AtlasPacker <output dir> <asset root> <dir> [<dir> ...]
+//
+// Sprites are keyed by their path relative to <asset root>, the same string
+// the game passes to TextureCache::load (e.g. "assets/enemies/slime.png").
+#define SDL_MAIN_HANDLED
+#include <SDL2/SDL.h>
+#include <SDL2/SDL_image.h>
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+namespace {
+
+const int PAGE_SIZE = 2048;
+const int PADDING = 2; // Room for a 1px extruded border around every sprite
+
+struct PackedSprite {
+    std::string key;
+    SDL_Surface* surface = nullptr;
+    int page = -1;
+    int x = 0;
+    int y = 0;
+};
+
+struct Shelf {
+    int y;
+    int height;
+    int cursorX;
+};
+
+struct Page {
+    std::vector<Shelf> shelves;
+    int usedHeight = 0;
+};
+
+// Shelf packing: sprites come in sorted by height, each goes on the first
+// shelf with room, otherwise a new shelf, otherwise a new page
+bool place(std::vector<Page>& pages, PackedSprite& sprite) {
+    int w = sprite.surface->w + PADDING * 2;
+    int h = sprite.surface->h + PADDING * 2;
+    if (w > PAGE_SIZE || h > PAGE_SIZE) {
+        return false;
+    }
+
+    for (size_t p = 0; p < pages.size(); p++) {
+        Page& page = pages[p];
+        for (Shelf& shelf : page.shelves) {
+            if (h <= shelf.height && shelf.cursorX + w <= PAGE_SIZE) {
+                sprite.page = static_cast<int>(p);
+                sprite.x = shelf.cursorX + PADDING;
+                sprite.y = shelf.y + PADDING;
+                shelf.cursorX += w;
+                return true;
+            }
+        }
+        if (page.usedHeight + h <= PAGE_SIZE) {
+            page.shelves.push_back({page.usedHeight, h, w});
+            sprite.page = static_cast<int>(p);
+            sprite.x = PADDING;
+            sprite.y = page.usedHeight + PADDING;
+            page.usedHeight += h;
+            return true;
+        }
+    }
+
+    pages.emplace_back();
+    return place(pages, sprite);
+}
+
+// Copies the sprite's outermost pixels one pixel outwards so linear
+// filtering at the sprite edge never samples a neighbour
+void extrude(SDL_Surface* page, const PackedSprite& sprite) {
+    Uint32* pixels = static_cast<Uint32*>(page->pixels);
+    int pitch = page->pitch / 4;
+    int w = sprite.surface->w;
+    int h = sprite.surface->h;
+
+    for (int y = 0; y < h; y++) {
+        Uint32* row = &pixels[(sprite.y + y) * pitch];
+        row[sprite.x - 1] = row[sprite.x];
+        row[sprite.x + w] = row[sprite.x + w - 1];
+    }
+    for (int x = -1; x <= w; x++) {
+        pixels[(sprite.y - 1) * pitch + sprite.x + x] = pixels[sprite.y * pitch + sprite.x + x];
+        pixels[(sprite.y + h) * pitch + sprite.x + x] = pixels[(sprite.y + h - 1) * pitch + sprite.x + x];
+    }
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    if (argc < 4) {
+        std::cout << "Usage: AtlasPacker <output dir> <asset root> <dir> [<dir> ...]" << std::endl;
+        return 1;
+    }
+
+    fs::path outputDir = argv[1];
+    fs::path root = argv[2];
+
+    if (!(IMG_Init(IMG_INIT_PNG) & IMG_INIT_PNG)) {
+        std::cout << "SDL_image could not initialize! SDL_image Error: " << IMG_GetError() << std::endl;
+        return 1;
+    }
+
+    // Gather sprites, keyed by path relative to the asset root
+    std::vector<PackedSprite> sprites;
+    for (int i = 3; i < argc; i++) {
+        fs::path dir = root / argv[i];
+        if (!fs::exists(dir)) {
+            std::cout << "Skipping missing directory " << dir.string() << std::endl;
+            continue;
+        }
+        for (const auto& entry : fs::recursive_directory_iterator(dir)) {
+            if (!entry.is_regular_file() || entry.path().extension() != ".png") continue;
+
+            SDL_Surface* loaded = IMG_Load(entry.path().string().c_str());
+            if (!loaded) {
+                std::cout << "Unable to load image " << entry.path().string() << "! SDL_image Error: " << IMG_GetError() << std::endl;
+                continue;
+            }
+            PackedSprite sprite;
+            sprite.key = fs::relative(entry.path(), root).generic_string();
+            sprite.surface = SDL_ConvertSurfaceFormat(loaded, SDL_PIXELFORMAT_RGBA32, 0);
+            SDL_FreeSurface(loaded);
+            if (sprite.surface) {
+                sprites.push_back(sprite);
+            }
+        }
+    }
+
+    // Tallest first packs shelves tightly; the key keeps the output deterministic
+    std::sort(sprites.begin(), sprites.end(), [](const PackedSprite& a, const PackedSprite& b) {
+        if (a.surface->h != b.surface->h) return a.surface->h > b.surface->h;
+        return a.key < b.key;
+    });
+
+    std::vector<Page> pages;
+    for (PackedSprite& sprite : sprites) {
+        if (!place(pages, sprite)) {
+            std::cout << "Sprite " << sprite.key << " is larger than an atlas page, left unpacked" << std::endl;
+        }
+    }
+
+    fs::create_directories(outputDir);
+    std::ofstream metadata(outputDir / "atlas.txt");
+    if (!metadata) {
+        std::cout << "Unable to write " << (outputDir / "atlas.txt").string() << std::endl;
+        return 1;
+    }
+    metadata << "# page <index> <file> <width> <height>\n";
+    metadata << "# sprite <key> <page> <x> <y> <width> <height>\n";
+
+    int result = 0;
+    for (size_t p = 0; p < pages.size(); p++) {
+        // Pages are only as tall as they need to be
+        int height = pages[p].usedHeight;
+        SDL_Surface* page = SDL_CreateRGBSurfaceWithFormat(0, PAGE_SIZE, height, 32, SDL_PIXELFORMAT_RGBA32);
+        if (!page) {
+            std::cout << "Unable to create atlas page! SDL Error: " << SDL_GetError() << std::endl;
+            result = 1;
+            break;
+        }
+        SDL_FillRect(page, nullptr, SDL_MapRGBA(page->format, 0, 0, 0, 0));
+
+        for (const PackedSprite& sprite : sprites) {
+            if (sprite.page != static_cast<int>(p)) continue;
+            SDL_SetSurfaceBlendMode(sprite.surface, SDL_BLENDMODE_NONE);
+            SDL_Rect dest = {sprite.x, sprite.y, sprite.surface->w, sprite.surface->h};
+            SDL_BlitSurface(sprite.surface, nullptr, page, &dest);
+            extrude(page, sprite);
+        }
+
+        std::string fileName = "atlas_" + std::to_string(p) + ".png";
+        if (IMG_SavePNG(page, (outputDir / fileName).string().c_str()) != 0) {
+            std::cout << "Unable to save " << fileName << "! SDL_image Error: " << IMG_GetError() << std::endl;
+            result = 1;
+        }
+        SDL_FreeSurface(page);
+        metadata << "page\t" << p << "\t" << fileName << "\t" << PAGE_SIZE << "\t" << height << "\n";
+    }
+
+    for (const PackedSprite& sprite : sprites) {
+        if (sprite.page >= 0) {
+            metadata << "sprite\t" << sprite.key << "\t" << sprite.page << "\t" << sprite.x << "\t" << sprite.y
+                     << "\t" << sprite.surface->w << "\t" << sprite.surface->h << "\n";
+        }
+        SDL_FreeSurface(sprite.surface);
+    }
+
+    std::cout << "Packed " << sprites.size() << " sprites into " << pages.size() << " atlas page(s)" << std::endl;
+
+    IMG_Quit();
+    return result;
+}